@@ -0,0 +1,99 @@
+#include "ResourceManager.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    /// @brief Stand-in resource. Only what the manager needs.
+    class DummyResource
+    {
+        public:
+            DummyResource(int value)
+                : m_value{value} {}
+
+            size_t get_byte_size() const noexcept { return sizeof(DummyResource); }
+
+            int get_value() const noexcept { return m_value; }
+
+        private:
+            int m_value{};
+    };
+
+    using DummyManager = sdl2::ResourceManager<DummyResource>;
+
+    /// @brief Map sizes measured. Each is grown from the last.
+    constexpr size_t MAP_SIZES[] = {16, 256, 1024, 4096, 16384};
+
+    /// @brief Lookups timed per map size.
+    constexpr size_t LOOKUP_COUNT = 1000000;
+
+    /// @brief Names the hot lookups cycle through. Small enough to stay in cache, so only the lookup itself is timed.
+    constexpr size_t HOT_COUNT = 64;
+
+    /// @brief Creations timed per map size. Each resource is dropped right away, so they pile up as expired entries.
+    constexpr size_t CHURN_COUNT = 100000;
+
+    /// @brief Returns the nanoseconds per iteration since the start passed.
+    double get_nanoseconds(std::chrono::steady_clock::time_point start, size_t iterations) noexcept
+    {
+        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        return elapsed.count() / iterations;
+    }
+}
+
+int main()
+{
+    // Live resources keep the map at the size being measured.
+    std::vector<std::shared_ptr<DummyResource>> liveResources{};
+    std::vector<std::string> names{};
+    size_t churnIndex{};
+    uint64_t checksum{};
+
+    std::printf("%8s %12s %12s %12s\n", "entries", "hot hit ns", "hit ns", "churn ns");
+    for (const size_t mapSize : MAP_SIZES)
+    {
+        while (names.size() < mapSize)
+        {
+            names.push_back("resource_" + std::to_string(names.size()));
+            liveResources.push_back(DummyManager::create_load_resource(names.back(), static_cast<int>(names.size())));
+        }
+
+        const size_t hotCount = std::min(HOT_COUNT, names.size());
+        auto start            = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < LOOKUP_COUNT; i++)
+        {
+            checksum += DummyManager::create_load_resource(names[i % hotCount], 0)->get_value();
+        }
+        const double hotTime = get_nanoseconds(start, LOOKUP_COUNT);
+
+        // Hits spread over every live name. This includes the cache misses of a bigger map.
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < LOOKUP_COUNT; i++)
+        {
+            const std::string &name = names[(i * 7919) % names.size()];
+            checksum += DummyManager::create_load_resource(name, 0)->get_value();
+        }
+        const double hitTime = get_nanoseconds(start, LOOKUP_COUNT);
+
+        // New names that expire immediately. Purging them is what used to scale with the map.
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < CHURN_COUNT; i++)
+        {
+            const std::string name = "expired_" + std::to_string(churnIndex++);
+            checksum += DummyManager::create_load_resource(name, 1)->get_value();
+        }
+        const double churnTime = get_nanoseconds(start, CHURN_COUNT);
+
+        std::printf("%8zu %12.1f %12.1f %12.1f\n", mapSize, hotTime, hitTime, churnTime);
+    }
+
+    // Keeps the lookups from being optimized out.
+    std::printf("checksum %llu\n", static_cast<unsigned long long>(checksum));
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,53 @@
+#include "Font.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace
+{
+    /// @brief Number of break and color points registered before each measurement.
+    constexpr size_t POINT_COUNTS[] = {5, 17, 65, 257};
+
+    /// @brief Characters laid out per measurement.
+    constexpr size_t TEXT_LENGTH = 1000000;
+
+    /// @brief Layouts timed per measurement.
+    constexpr size_t LAYOUT_COUNT = 10;
+
+    /// @brief First codepoint registered. Points are kept out of the text so every one is a miss, like most characters.
+    constexpr uint32_t FIRST_POINT = 0x4E00;
+}
+
+int main()
+{
+    // Printable ASCII with a space every so often, so words stay short like real text.
+    std::string text{};
+    text.reserve(TEXT_LENGTH);
+    for (size_t i = 0; i < TEXT_LENGTH; i++) { text.push_back(i % 8 == 7 ? ' ' : static_cast<char>('!' + i % 94)); }
+
+    // A font without faces still decodes and classifies every character, but doesn't load glyphs. That's all that's
+    // timed here.
+    sdl2::Font font{};
+    uint32_t nextPoint = FIRST_POINT;
+    size_t pointCount{};
+
+    std::printf("%8s %12s\n", "points", "ns/char");
+    for (const size_t targetCount : POINT_COUNTS)
+    {
+        for (; pointCount < targetCount; pointCount++, nextPoint++)
+        {
+            sdl2::Font::add_break_point(nextPoint);
+            sdl2::Font::add_color_point(nextPoint + 0x1000, {0xFF, 0x00, 0x00, 0xFF});
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < LAYOUT_COUNT; i++) { font.create_layout(text, INT32_MAX); }
+        const std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+
+        std::printf("%8zu %12.2f\n", pointCount, elapsed.count() / (TEXT_LENGTH * LAYOUT_COUNT));
+    }
+
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,118 @@
+#include "AssetPackFormat.hpp"
+#include "Hash.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    /// @brief File being packed.
+    struct PackFile
+    {
+        std::filesystem::path path{};
+        std::string name{};
+        sdl2::pack::Entry entry{};
+    };
+
+    /// @brief Rounds the value passed up to the data alignment.
+    uint64_t align_up(uint64_t value) noexcept
+    {
+        return (value + sdl2::pack::DATA_ALIGNMENT - 1) & ~(sdl2::pack::DATA_ALIGNMENT - 1);
+    }
+
+    /// @brief Writes zeroes until the file is at the offset passed.
+    void pad_to(std::ofstream &packFile, uint64_t offset)
+    {
+        static constexpr char ZERO = 0x00;
+        while (static_cast<uint64_t>(packFile.tellp()) < offset) { packFile.write(&ZERO, 1); }
+    }
+}
+
+int main(int argc, const char *argv[])
+{
+    if (argc != 3)
+    {
+        std::printf("Usage: %s <directory> <output.pak>\n", argv[0]);
+        return 1;
+    }
+
+    const std::filesystem::path directory = argv[1];
+    const std::filesystem::path output    = argv[2];
+
+    // Gather everything. Names are relative to the directory so they match the paths used to load them.
+    std::vector<PackFile> files{};
+    std::error_code error{};
+    for (const auto &dirEntry : std::filesystem::recursive_directory_iterator(directory, error))
+    {
+        if (!dirEntry.is_regular_file()) { continue; }
+
+        PackFile file{};
+        file.path           = dirEntry.path();
+        file.name           = dirEntry.path().lexically_relative(directory).generic_string();
+        file.entry.nameHash = sdl2::fnv1a_64(file.name);
+        file.entry.dataSize = dirEntry.file_size();
+        files.push_back(std::move(file));
+    }
+
+    if (error)
+    {
+        std::printf("Error reading %s: %s\n", directory.string().c_str(), error.message().c_str());
+        return 1;
+    }
+
+    // The reader binary searches by hash.
+    auto compare = [](const PackFile &fileA, const PackFile &fileB) { return fileA.entry.nameHash < fileB.entry.nameHash; };
+    std::sort(files.begin(), files.end(), compare);
+
+    // Lay out the names and then the data.
+    std::string names{};
+    for (PackFile &file : files)
+    {
+        file.entry.nameOffset = names.size();
+        file.entry.nameLength = file.name.size();
+        names += file.name;
+    }
+
+    const uint64_t indexSize = sizeof(sdl2::pack::Header) + (files.size() * sizeof(sdl2::pack::Entry));
+    uint64_t dataOffset      = align_up(indexSize + names.size());
+    for (PackFile &file : files)
+    {
+        file.entry.dataOffset = dataOffset;
+        dataOffset            = align_up(dataOffset + file.entry.dataSize);
+    }
+
+    std::ofstream packFile{output, std::ios::binary};
+    if (!packFile.is_open())
+    {
+        std::printf("Error opening %s for writing.\n", output.string().c_str());
+        return 1;
+    }
+
+    const sdl2::pack::Header header = {.magic      = sdl2::pack::MAGIC,
+                                       .version    = sdl2::pack::VERSION,
+                                       .entryCount = static_cast<uint32_t>(files.size()),
+                                       .namesSize  = static_cast<uint32_t>(names.size())};
+    packFile.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    for (const PackFile &file : files) { packFile.write(reinterpret_cast<const char *>(&file.entry), sizeof(file.entry)); }
+    packFile.write(names.data(), names.size());
+
+    for (const PackFile &file : files)
+    {
+        pad_to(packFile, file.entry.dataOffset);
+
+        std::ifstream inputFile{file.path, std::ios::binary};
+        packFile << inputFile.rdbuf();
+        if (static_cast<uint64_t>(packFile.tellp()) != file.entry.dataOffset + file.entry.dataSize)
+        {
+            std::printf("Error packing %s.\n", file.path.string().c_str());
+            return 1;
+        }
+    }
+
+    std::printf("Packed %zu files into %s.\n", files.size(), output.string().c_str());
+    return packFile.good() ? 0 : 1;
+}
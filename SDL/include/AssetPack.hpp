@@ -0,0 +1,56 @@
+#pragma once
+#include "AssetPackFormat.hpp"
+#include "CoreComponent.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string_view>
+
+namespace sdl2
+{
+    /// @brief Reads an asset pack built by the PackTool with a single read and serves views into it.
+    /** @note
+     *  Views are only valid as long as the pack is. Texture, Font, Sound and surface::from_memory all take them
+     *  directly. Fonts keep using the view after construction, so the pack must outlive any font created from it.
+     */
+    class AssetPack final : public sdl2::CoreComponent
+    {
+        public:
+            /// @brief Default constructor.
+            AssetPack() = default;
+
+            /// @brief Loads the pack at the path passed.
+            /// @param packPath Path of the pack.
+            AssetPack(std::string_view packPath);
+
+            /// @brief Returns the data of the asset with the name passed.
+            /// @param name Name of the asset. This is its path relative to the directory that was packed.
+            /// @return View of the data on success. nullopt if the asset isn't in the pack.
+            std::optional<std::span<const std::byte>> find(std::string_view name) const noexcept;
+
+            /// @brief Returns whether or not the pack contains the asset passed.
+            /// @param name Name of the asset.
+            bool contains(std::string_view name) const noexcept;
+
+            /// @brief Returns the number of assets in the pack.
+            size_t get_entry_count() const noexcept;
+
+        private:
+            /// @brief The whole pack.
+            std::unique_ptr<std::byte[]> m_packData{};
+
+            /// @brief Size of the pack.
+            size_t m_packSize{};
+
+            /// @brief Index of the pack. Points into m_packData.
+            std::span<const sdl2::pack::Entry> m_entries{};
+
+            /// @brief Names of the entries. Points into m_packData.
+            std::string_view m_names{};
+
+            /// @brief Makes sure the header and index are sane before anything is served from them.
+            bool validate();
+    };
+}
\ No newline at end of file
@@ -0,0 +1,47 @@
+#pragma once
+#include <array>
+#include <cstdint>
+
+namespace sdl2
+{
+    /// @brief On disk layout of asset packs. Shared with the PackTool, so this can't depend on anything else.
+    /** @note
+     *  A pack is the header, followed by the entries sorted by name hash, followed by the names, followed by the data.
+     *  Everything is little endian. Names are paths relative to the packed directory using forward slashes.
+     */
+    namespace pack
+    {
+        /// @brief Magic every pack starts with.
+        static constexpr std::array<char, 4> MAGIC = {'S', 'P', 'A', 'K'};
+
+        /// @brief Current version of the format.
+        static constexpr uint32_t VERSION = 1;
+
+        /// @brief Data of every entry starts on a multiple of this.
+        static constexpr uint64_t DATA_ALIGNMENT = 16;
+
+        // clang-format off
+        /// @brief Pack header.
+        struct Header
+        {
+            std::array<char, 4> magic{};
+            uint32_t version{};
+            uint32_t entryCount{};
+            uint32_t namesSize{};
+        };
+
+        /// @brief Index entry. Offsets are from the start of the pack.
+        struct Entry
+        {
+            uint64_t nameHash{};
+            uint64_t dataOffset{};
+            uint64_t dataSize{};
+            uint32_t nameOffset{};
+            uint32_t nameLength{};
+        };
+        // clang-format on
+
+        static_assert(sizeof(Header) == 16, "pack::Header has padding.");
+        static_assert(sizeof(Entry) == 32, "pack::Entry has padding.");
+    }
+}
\ No newline at end of file
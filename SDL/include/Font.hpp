@@ -1,13 +1,13 @@
 #pragma once
 #include "CoreComponent.hpp"
-#include "Freetype.hpp"
+#include "GlyphSet.hpp"
 #include "OptionalReference.hpp"
-#include "ResourceManager.hpp"
+#include "TextLayout.hpp"
 
 #include <SDL2/SDL.h>
+#include <bitset>
 #include <span>
 #include <string_view>
-#include <unordered_map>
 #include <vector>
 
 namespace sdl2
@@ -15,16 +15,8 @@ namespace sdl2
     class Font : public sdl2::CoreComponent
     {
         public:
-            // clang-format off
             /// @brief Struct containing cached data.
-            struct GlyphData
-            {
-                int16_t advanceX{};
-                int16_t top{};
-                int16_t left{};
-                sdl2::SharedTexture texture{};
-            };
-            // clang-format on
+            using GlyphData = sdl2::GlyphData;
 
             /// @brief Default constructor.
             Font() = default;
@@ -34,12 +26,23 @@ namespace sdl2
             /// @param pixelSize Size of the font in pixels.
             Font(std::string_view fontPath, int pixelSize);
 
+            /// @brief Loads a font from the data passed without copying it.
+            /// @param fontData View of the font data, such as one from an AssetPack. It must outlive the font.
+            /// @param pixelSize Size of the font in pixels.
+            Font(std::span<const std::byte> fontData, int pixelSize);
+
             /// @brief Destructs the font.
             virtual ~Font();
 
             /// @brief Returns the pixel size of the font.
             int get_pixel_size() const noexcept;
 
+            /// @brief Returns the estimated memory used by the font in bytes. This is its decode buffer plus its share of the
+            /// glyph pages and font buffers it uses.
+            /// @note Glyph sets and faces are shared through the FontRegistry, so each font is only charged its share. Added
+            /// up over every font, shared memory is counted once. FontRegistry::get_stats() reports it in total.
+            size_t get_byte_size() const noexcept;
+
             /// @brief Renders text at the coordinates provided.
             /// @param x X coordinate.
             /// @param y Y coordinate.
@@ -52,12 +55,49 @@ namespace sdl2
             /// @param y Y coordinate.
             /// @param maxWidth Maximum width of the text before it's wrapped to a new line.
             /// @param text Text to render.
+            /// @note The layout is cached, so rendering the same text with the same width again only replays it.
             void render_text_wrapped(int x, int y, SDL_Color color, int maxWidth, std::string_view text);
 
+            /// @brief Computes the glyph positions, line breaks and color changes of wrapped text.
+            /// @param text Text to lay out.
+            /// @param maxWidth Maximum width of the text before it's wrapped to a new line.
+            sdl2::TextLayout create_layout(std::string_view text, int maxWidth);
+
+            /// @brief Returns the cached layout for the text and width passed, creating it if needed.
+            /// @param text Text to lay out.
+            /// @param maxWidth Maximum width of the text before it's wrapped to a new line.
+            /// @note The reference is only valid until the next layout is created.
+            const sdl2::TextLayout &get_layout(std::string_view text, int maxWidth);
+
+            /// @brief Renders a layout created by this font.
+            /// @param layout Layout to render.
+            /// @param x X coordinate.
+            /// @param y Y coordinate.
+            /// @param color Color to render text with.
+            void render_layout(const sdl2::TextLayout &layout, int x, int y, SDL_Color color);
+
+            /// @brief Sets the number of layouts the font keeps cached.
+            /// @param capacity Number of layouts to keep.
+            void set_layout_cache_size(size_t capacity);
+
             /// @brief Gets the width of the text passed.
             /// @param text Text to get the width of.
             int get_text_width(std::string_view text);
 
+            /// @brief Rasterizes the glyphs of the text passed in the background so drawing it later doesn't stall.
+            /// @param text Text containing the characters to prewarm.
+            /// @note Queued glyphs are skipped when drawn until they land. GlyphRasterizer::finish_pending() waits for them.
+            void prewarm(std::string_view text);
+
+            /// @brief Rasterizes the glyphs of every string passed in the background.
+            /// @param strings Strings containing the characters to prewarm.
+            void prewarm(std::span<const std::string_view> strings);
+
+            /// @brief Rasterizes the glyphs of a range of codepoints in the background.
+            /// @param first First codepoint of the range.
+            /// @param last Last codepoint of the range.
+            void prewarm_range(uint32_t first, uint32_t last);
+
             /// @brief Adds a codepoint to the list of characters to break at for rendering wrapped text.
             /// @param codepoint Codepoint to enable line breaking at.
             static void add_break_point(uint32_t codepoint);
@@ -87,37 +127,65 @@ namespace sdl2
             /// @brief Stores the pixel size of the font.
             int m_pixelSize{};
 
-            /// @brief
-            FT_Face m_fontFace{};
+            /// @brief Glyphs of the font's faces at its size. Shared with every other font using the same faces and size.
+            std::shared_ptr<sdl2::GlyphSet> m_glyphSet{};
+
+            /// @brief Codepoints of the text being drawn or measured. Reused so decoding doesn't allocate.
+            std::vector<uint32_t> m_codepoints{};
 
-            /// @brief Buffer used for storing the font in RAM instead of reading from I/O. Gives a decent speed up.
-            std::unique_ptr<FT_Byte[]> m_fontBuffer{};
+            /// @brief Cache of wrapped text layouts.
+            sdl2::TextLayoutCache m_layoutCache{};
 
-            /// @brief Unordered_map used for cacheing glyph data and textures.
-            std::unordered_map<uint32_t, Font::GlyphData> m_cacheMap{};
+            /// @brief Break and color point generation the layout cache was built with.
+            uint32_t m_layoutGeneration{};
 
-            /// @brief All instances share this instance of Freetype.
-            static inline sdl2::Freetype sm_freetype{};
+            /// @brief Glyph set generation the layout cache was built with.
+            uint32_t m_layoutGlyphGeneration{};
 
-            /// @brief Virtual. Searches the map for the codepoint passed or loads it if needed.
+            /// @brief Gets the glyph set for the face passed from the registry.
+            /// @param face Face of the font.
+            bool load_glyph_set(std::shared_ptr<sdl2::FontFace> face);
+
+            /// @brief Searches the cache for the codepoint passed or loads it if needed.
             /// @param codepoint Codepoint to find or load.
-            /// @return Reference to the glyph data for the code point.
-            virtual OptionalReference<Font::GlyphData> find_load_glyph(uint32_t codepoint);
+            /// @return Reference to the glyph data for the code point. Only valid until the next glyph is loaded.
+            OptionalReference<const Font::GlyphData> find_load_glyph(uint32_t codepoint);
 
-            /// @brief Converts the FT_Bitmap passed into an SDL_Texture/shared texture.
-            /// @param codepoint Glyph codepoint.
-            /// @param glyphBitmap Bitmap of the glyph.
-            sdl2::SharedTexture convert_glyph_to_texture(uint32_t codepoint, const FT_Bitmap glyphBitmap);
+            /// @brief Renders a glyph from its atlas page.
+            /// @param page Atlas page of the glyph.
+            /// @param source Source rectangle of the glyph on the page.
+            /// @param x X coordinate.
+            /// @param y Y coordinate.
+            /// @param color Color to render the glyph with.
+            void render_glyph(int page, const SDL_Rect &source, int x, int y, SDL_Color color);
 
         private:
-            /// @brief Vector of breakpoints for wrapping.
+            /// @brief Codepoints in the Basic Multilingual Plane. Break and color points in it are classified with a bitset.
+            static constexpr uint32_t BMP_SIZE = 0x10000;
+
+            /// @brief Which BMP codepoints are breakpoints.
+            static inline std::bitset<BMP_SIZE> sm_breakBits{};
+
+            /// @brief Breakpoints above the BMP, sorted.
             static inline std::vector<uint32_t> sm_breakPoints{};
 
-            /// @brief Vector of color changing codepoints.
+            /// @brief Which BMP codepoints change color.
+            static inline std::bitset<BMP_SIZE> sm_colorBits{};
+
+            /// @brief Color changing codepoints paired with their color, sorted by codepoint.
             static inline std::vector<std::pair<uint32_t, SDL_Color>> sm_colorPoints{};
 
-            /// @brief Locates the next breakpoint in the string starting from i.
-            size_t find_next_breakpoint(std::string_view string);
+            /// @brief Incremented whenever break or color points change. Cached layouts built before are stale.
+            static inline uint32_t sm_pointGeneration{};
+
+            /// @brief Locates the next breakpoint in the codepoints passed.
+            /// @param codepoints Codepoints to search.
+            /// @return Number of codepoints up to and including the breakpoint. The size of the span if there isn't one.
+            size_t find_next_breakpoint(std::span<const uint32_t> codepoints) const noexcept;
+
+            /// @brief Returns the width of the codepoints passed.
+            /// @param codepoints Codepoints to measure.
+            int get_codepoints_width(std::span<const uint32_t> codepoints);
 
             /// @brief Returns whether or not the codepoint passed is a breakpoint.
             /// @param codepoint Codepoint to check.
@@ -135,5 +203,18 @@ namespace sdl2
             /// @param originalColor The original color passed to the render_text(_x) function.
             /// @param renderColor The color currently being used for rendering.
             void change_text_color(uint32_t codepoint, SDL_Color originalColor, SDL_Color &renderColor) const noexcept;
+
+            /// @brief Adds a breakpoint to the bitset or sorted vector without bumping the point generation.
+            /// @param codepoint Codepoint to add.
+            static void insert_break_point(uint32_t codepoint);
+
+            /// @brief Adds a color point without bumping the point generation. The first color added for a codepoint is
+            /// kept.
+            /// @param codepoint Codepoint to add.
+            /// @param color Color to change to.
+            static void insert_color_point(uint32_t codepoint, SDL_Color color);
+
+            /// @brief Returns the bottom of the renderer's visible area. INT_MAX if it isn't known.
+            static int get_visible_bottom() noexcept;
     };
 }
\ No newline at end of file
@@ -0,0 +1,95 @@
+#pragma once
+#include "CoreComponent.hpp"
+#include "Freetype.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace sdl2
+{
+    // clang-format off
+    /// @brief Run of consecutive codepoints a face has glyphs for.
+    struct CoverageRange
+    {
+        uint32_t first{};
+        uint32_t last{};
+    };
+    // clang-format on
+
+    /// @brief A single FreeType face. Faces are created once through the FontRegistry and shared by every size of font
+    /// that uses them.
+    class FontFace final : public sdl2::CoreComponent
+    {
+        public:
+            // No copying or moving.
+            FontFace(const FontFace &)            = delete;
+            FontFace(FontFace &&)                 = delete;
+            FontFace &operator=(const FontFace &) = delete;
+            FontFace &operator=(FontFace &&)      = delete;
+
+            /// @brief Reads the font file passed into memory and creates the face from it.
+            /// @param fontPath Path of the font file.
+            FontFace(std::string_view fontPath);
+
+            /// @brief Creates the face from the data passed without copying it.
+            /// @param fontData Font data. It must outlive the face.
+            FontFace(std::span<const std::byte> fontData);
+
+            /// @brief Frees the face and every size created for it.
+            ~FontFace();
+
+            /// @brief Returns the underlying face.
+            FT_Face get() const noexcept;
+
+            /// @brief Returns the lock every FreeType call on the face or its sizes has to hold. Fonts are created and freed
+            /// from whichever thread uses the FontManager while the render thread draws from the same faces.
+            std::mutex &get_lock() const noexcept;
+
+            /// @brief Returns the size of the font buffer the face owns in bytes. 0 if it doesn't own one.
+            size_t get_buffer_size() const noexcept;
+
+            /// @brief Returns the font data the face was created from.
+            std::span<const std::byte> get_data() const noexcept;
+
+            /// @brief Returns the codepoints the face has glyphs for as sorted ranges.
+            std::span<const sdl2::CoverageRange> get_coverage() const noexcept;
+
+        private:
+            /// @brief Buffer the font file was read into.
+            std::unique_ptr<FT_Byte[]> m_fontBuffer{};
+
+            /// @brief Size of the font buffer.
+            size_t m_fontBufferSize{};
+
+            /// @brief Font data the face was created from. Background rasterizers create their own faces from this.
+            std::span<const std::byte> m_fontData{};
+
+            /// @brief Underlying face.
+            FT_Face m_face{};
+
+            /// @brief Codepoints the face covers. Built once when the face is created.
+            std::vector<sdl2::CoverageRange> m_coverage{};
+
+            /// @brief Serializes FreeType calls on the face.
+            mutable std::mutex m_faceLock{};
+
+            /// @brief Every face shares this instance of Freetype.
+            static inline sdl2::Freetype sm_freetype{};
+
+            /// @brief Serializes creating and freeing faces, since they all belong to the shared library.
+            static inline std::mutex sm_libraryLock{};
+
+            /// @brief Creates the face from the data passed.
+            /// @param fontData Font data. This is used by FreeType until the face is freed.
+            /// @param dataSize Size of the font data.
+            bool create_face(const FT_Byte *fontData, size_t dataSize);
+
+            /// @brief Walks the face's character map and records the ranges of codepoints it covers.
+            void build_coverage();
+    };
+}
\ No newline at end of file
@@ -0,0 +1,103 @@
+#pragma once
+#include "FontFace.hpp"
+#include "GlyphSet.hpp"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace sdl2
+{
+    // clang-format off
+    /// @brief Memory held by the faces and glyph sets fonts share. Each is counted once no matter how many fonts use it.
+    struct FontRegistryStats
+    {
+        /// @brief Live faces.
+        size_t faceCount{};
+
+        /// @brief Font buffers owned by the live faces in bytes. Faces created from memory don't own theirs.
+        size_t faceBytes{};
+
+        /// @brief Live glyph sets.
+        size_t glyphSetCount{};
+
+        /// @brief Atlas pages of the live glyph sets in bytes.
+        size_t glyphBytes{};
+    };
+    // clang-format on
+
+    /// @brief Creates each font face once and shares glyph sets between fonts using the same faces at the same size.
+    /** @note
+     *  The registry only holds weak pointers. Faces and glyph sets are freed once the last font using them is.
+     */
+    class FontRegistry final
+    {
+        public:
+            // No copying or moving.
+            FontRegistry(const FontRegistry &)            = delete;
+            FontRegistry(FontRegistry &&)                 = delete;
+            FontRegistry &operator=(const FontRegistry &) = delete;
+            FontRegistry &operator=(FontRegistry &&)      = delete;
+
+            /// @brief Returns the face for the font file passed, loading it if it isn't already.
+            /// @param fontPath Path of the font file.
+            static std::shared_ptr<sdl2::FontFace> load_face(std::string_view fontPath);
+
+            /// @brief Returns the face for the font data passed, creating it if it isn't already. Faces are matched by the
+            /// address of the data.
+            /// @param fontData Font data. It must outlive the face.
+            static std::shared_ptr<sdl2::FontFace> load_face(std::span<const std::byte> fontData);
+
+            /// @brief Returns the glyph set for the faces and size passed, creating it if it doesn't exist.
+            /// @param faces Faces to render glyphs from, in the order they're searched.
+            /// @param pixelSize Size of the glyphs in pixels.
+            static std::shared_ptr<sdl2::GlyphSet> get_glyph_set(std::span<const std::shared_ptr<sdl2::FontFace>> faces,
+                                                                 int pixelSize);
+
+            /// @brief Returns the memory held by the live faces and glyph sets.
+            static sdl2::FontRegistryStats get_stats();
+
+        private:
+            /// @brief Glyph sets are keyed by their faces and their pixel size.
+            using GlyphSetKey = std::pair<std::vector<const sdl2::FontFace *>, int>;
+
+            // clang-format off
+            struct StringViewHash
+            {
+                using is_transparent = void;
+                size_t operator() (std::string_view view) const noexcept { return std::hash<std::string_view>{}(view); }
+            };
+
+            struct StringViewEquals
+            {
+                using is_transparent = void;
+                bool operator() (std::string_view viewA, std::string_view viewB) const noexcept { return viewA == viewB; }
+            };
+            // clang-format on
+
+            /// @brief Guards the maps. Fonts can be created from any thread the FontManager is used on. FreeType calls on the
+            /// shared faces are serialized by the faces' own locks.
+            std::mutex m_registryLock{};
+
+            /// @brief Faces loaded from files.
+            std::unordered_map<std::string, std::weak_ptr<sdl2::FontFace>, StringViewHash, StringViewEquals> m_fileFaces{};
+
+            /// @brief Faces created from memory.
+            std::unordered_map<const std::byte *, std::weak_ptr<sdl2::FontFace>> m_memoryFaces{};
+
+            /// @brief Glyph sets.
+            std::map<GlyphSetKey, std::weak_ptr<sdl2::GlyphSet>> m_glyphSets{};
+
+            /// @brief Private constructor.
+            FontRegistry() = default;
+
+            /// @brief Returns the instance.
+            static FontRegistry &get_instance();
+    };
+}
\ No newline at end of file
@@ -0,0 +1,140 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <string_view>
+
+namespace sdl2
+{
+    /// @brief Forward declarations to prevent clashes.
+    class Font;
+    class Renderer;
+
+    /// @brief Records how long each part of a frame takes. The renderer drives this from frame_begin and frame_end.
+    /** @note
+     *  Update is the time between the last present returning and frame_begin. Render is frame_begin until the present.
+     *  Present is the time spent in SDL_RenderPresent, which is mostly waiting for vsync.
+     */
+    class FrameProfiler final
+    {
+        public:
+            /// @brief Parts of the frame that are timed.
+            enum class Phase : uint8_t
+            {
+                Update,
+                Render,
+                Present,
+                Frame
+            };
+
+            // clang-format off
+            /// @brief Timing of a single frame in milliseconds.
+            struct FrameTiming
+            {
+                float update{};
+                float render{};
+                float present{};
+                float frame{};
+            };
+
+            /// @brief Statistics of a phase over the history in milliseconds.
+            struct Statistics
+            {
+                float average{};
+                float minimum{};
+                float median{};
+                float percentile95{};
+                float percentile99{};
+                float maximum{};
+            };
+            // clang-format on
+
+            /// @brief Number of frames kept in the history.
+            static constexpr size_t HISTORY_LENGTH = 240;
+
+            /// @brief Number of buckets in the frame time histogram.
+            static constexpr size_t HISTOGRAM_BUCKETS = 16;
+
+            /// @brief Width of each histogram bucket in milliseconds. The last bucket holds everything past the end.
+            static constexpr float HISTOGRAM_BUCKET_WIDTH = 2.0f;
+
+            /// @brief Default constructor. Time to first frame is measured from here.
+            FrameProfiler();
+
+            /// @brief Enables or disables recording.
+            /// @param enabled Whether or not frames should be recorded.
+            void set_enabled(bool enabled) noexcept;
+
+            /// @brief Returns whether or not recording is enabled.
+            bool is_enabled() const noexcept;
+
+            /// @brief Marks the end of the update and start of rendering. Called by Renderer::frame_begin.
+            void frame_begin() noexcept;
+
+            /// @brief Marks the start of the present. Called by Renderer::frame_end.
+            void present_begin() noexcept;
+
+            /// @brief Marks the end of the present and records the frame. Called by Renderer::frame_end.
+            void present_end() noexcept;
+
+            /// @brief Returns the number of frames recorded since the profiler was enabled.
+            uint64_t get_frame_count() const noexcept;
+
+            /// @brief Returns the milliseconds between the profiler being constructed and the first present finishing.
+            /// @note Recorded whether or not the profiler is enabled. 0 until the first frame is presented.
+            float get_time_to_first_frame() const noexcept;
+
+            /// @brief Returns the timing of the last complete frame.
+            FrameProfiler::FrameTiming get_last_frame() const noexcept;
+
+            /// @brief Returns statistics of the phase passed over the history.
+            /// @param phase Phase to get the statistics of.
+            FrameProfiler::Statistics get_statistics(FrameProfiler::Phase phase) const noexcept;
+
+            /// @brief Returns a histogram of frame times over the history.
+            std::array<uint32_t, HISTOGRAM_BUCKETS> get_histogram() const noexcept;
+
+            /// @brief Renders an overlay with the timings of the last frame and the history.
+            /// @param renderer Renderer to render the background with.
+            /// @param font Font to render text with. SystemFont works fine.
+            /// @param x X coordinate.
+            /// @param y Y coordinate.
+            void render_overlay(sdl2::Renderer &renderer, sdl2::Font &font, int x, int y) const;
+
+            /// @brief Writes the history to a CSV file, oldest frame first.
+            /// @param filePath Path to write to.
+            /// @return True on success. False on failure.
+            bool write_csv(std::string_view filePath) const;
+
+        private:
+            /// @brief Whether or not frames are recorded.
+            bool m_isEnabled{true};
+
+            /// @brief Performance counter values marking the boundaries of the frame.
+            uint64_t m_presentEnd{};
+            uint64_t m_frameBegin{};
+            uint64_t m_presentBegin{};
+
+            /// @brief Performance counter value when the profiler was constructed.
+            uint64_t m_startCounter{};
+
+            /// @brief Time to first frame in milliseconds.
+            float m_timeToFirstFrame{};
+
+            /// @brief Ring buffer of recorded frames.
+            std::array<FrameProfiler::FrameTiming, HISTORY_LENGTH> m_history{};
+
+            /// @brief Number of frames recorded.
+            uint64_t m_frameCount{};
+
+            /// @brief Returns the number of frames in the history.
+            size_t get_history_size() const noexcept;
+
+            /// @brief Converts performance counter ticks to milliseconds.
+            static float to_milliseconds(uint64_t ticks) noexcept;
+
+            /// @brief Returns the value of the phase from the frame timing passed.
+            static float get_phase(const FrameProfiler::FrameTiming &timing, FrameProfiler::Phase phase) noexcept;
+    };
+}
\ No newline at end of file
@@ -6,9 +6,9 @@
 
 namespace sdl2
 {
-    /// @brief Forward declaration to allow the Font class to access the FT_Library.
-    class Font;
-    class SystemFont;
+    /// @brief Forward declarations to allow these classes to access the FT_Library.
+    class FontFace;
+    class GlyphRasterizer;
 
     /// @brief Wrapper class around Freetype.
     class Freetype final : public sdl2::CoreComponent
@@ -44,9 +44,11 @@ namespace sdl2
                 m_library = nullptr;
             }
 
-            /// @brief This allows the Font class to use the library.
-            friend class Font;
-            friend class SystemFont;
+            /// @brief This allows the FontFace class to use the library.
+            friend class FontFace;
+
+            /// @brief Each glyph rasterizer worker creates its own library.
+            friend class GlyphRasterizer;
 
         private:
             /// @brief Library.
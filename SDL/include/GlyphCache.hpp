@@ -0,0 +1,118 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <vector>
+
+namespace sdl2
+{
+    // clang-format off
+    /// @brief Cached data of a rendered glyph.
+    struct GlyphData
+    {
+        /// @brief Page of glyphs cached as missing from every face.
+        static constexpr int16_t MISSING_PAGE = -2;
+
+        /// @brief Page of glyphs still being rasterized in the background.
+        static constexpr int16_t PENDING_PAGE = -3;
+
+        int16_t advanceX{};
+        int16_t top{};
+        int16_t left{};
+        int16_t page{-1};
+        SDL_Rect source{};
+    };
+    // clang-format on
+
+    /// @brief Glyph cache tuned for lookups. Codepoints below DENSE_SIZE are indexed directly, the rest go through an
+    /// open addressing table.
+    /** @note
+     *  ASCII and Latin-1 cover nearly all of what's usually drawn, so most lookups are a bit test and an array index.
+     *  References returned are only valid until the next insertion.
+     */
+    class GlyphCache final
+    {
+        public:
+            /// @brief Codepoints below this are stored in the dense array.
+            static constexpr uint32_t DENSE_SIZE = 256;
+
+            /// @brief Default constructor.
+            GlyphCache() = default;
+
+            /// @brief Searches the cache for the codepoint passed.
+            /// @param codepoint Codepoint to search for.
+            /// @return Pointer to the glyph. nullptr if it isn't cached.
+            /// @note This is defined here so it can be inlined into the text loops.
+            const sdl2::GlyphData *find(uint32_t codepoint) const noexcept
+            {
+                if (codepoint < DENSE_SIZE) { return m_denseLoaded[codepoint] ? &m_dense[codepoint] : nullptr; }
+                if (m_slots.empty()) { return nullptr; }
+
+                for (size_t index = GlyphCache::get_home(codepoint);; index = (index + 1) & m_slotMask)
+                {
+                    const GlyphCache::Slot &slot = m_slots[index];
+                    if (slot.codepoint == codepoint) { return &slot.glyph; }
+                    else if (slot.codepoint == EMPTY_CODEPOINT) { return nullptr; }
+                }
+            }
+
+            /// @brief Inserts a glyph. Existing glyphs are overwritten.
+            /// @param codepoint Codepoint of the glyph.
+            /// @param glyph Glyph data.
+            /// @return Reference to the cached glyph.
+            const sdl2::GlyphData &insert(uint32_t codepoint, const sdl2::GlyphData &glyph);
+
+            /// @brief Returns the number of glyphs cached.
+            size_t get_size() const noexcept;
+
+            /// @brief Removes every glyph from the cache.
+            void clear();
+
+        private:
+            // clang-format off
+            /// @brief Slot in the open addressing table.
+            struct Slot
+            {
+                uint32_t codepoint{EMPTY_CODEPOINT};
+                sdl2::GlyphData glyph{};
+            };
+            // clang-format on
+
+            /// @brief Marks an empty slot. This is above the highest valid codepoint.
+            static constexpr uint32_t EMPTY_CODEPOINT = UINT32_MAX;
+
+            /// @brief Number of slots allocated the first time the table is used.
+            static constexpr size_t INITIAL_SLOTS = 64;
+
+            /// @brief Glyphs for codepoints below DENSE_SIZE.
+            std::array<sdl2::GlyphData, DENSE_SIZE> m_dense{};
+
+            /// @brief Which dense glyphs are loaded.
+            std::bitset<DENSE_SIZE> m_denseLoaded{};
+
+            /// @brief Open addressing table for every other codepoint. The size is always a power of two.
+            std::vector<GlyphCache::Slot> m_slots{};
+
+            /// @brief Slot count minus one.
+            size_t m_slotMask{};
+
+            /// @brief 32 minus the log2 of the slot count. Shifts the top bits of a hash down to a slot index.
+            uint32_t m_slotShift{};
+
+            /// @brief Number of slots in use.
+            size_t m_slotCount{};
+
+            /// @brief Returns the slot the codepoint passed probes from.
+            /// @param codepoint Codepoint to hash.
+            size_t get_home(uint32_t codepoint) const noexcept
+            {
+                // Fibonacci hashing spreads the runs of neighbouring codepoints scripts use. The top bits of the product
+                // depend on every bit of the codepoint, so those are the ones kept.
+                return static_cast<uint32_t>(codepoint * 0x9E3779B1u) >> m_slotShift;
+            }
+
+            /// @brief Doubles the size of the table and reinserts every slot.
+            void grow();
+    };
+}
\ No newline at end of file
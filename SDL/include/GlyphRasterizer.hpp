@@ -0,0 +1,166 @@
+#pragma once
+#include "GlyphSet.hpp"
+#include "Surface.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace sdl2
+{
+    /// @brief Rasterizes glyphs in the background. Glyphs are rendered on worker threads and packed into their set's atlas
+    /// on the render thread.
+    /** @note
+     *  Every worker creates its own FT_Library and faces from the font data, since FreeType objects can't be shared
+     *  between threads. Queued glyphs are cached as pending and skipped when text is drawn until they land. Everything
+     *  here is meant to be called from the render thread. Renderer::frame_begin() calls process_uploads().
+     */
+    class GlyphRasterizer final
+    {
+        public:
+            // No copying or moving.
+            GlyphRasterizer(const GlyphRasterizer &)            = delete;
+            GlyphRasterizer(GlyphRasterizer &&)                 = delete;
+            GlyphRasterizer &operator=(const GlyphRasterizer &) = delete;
+            GlyphRasterizer &operator=(GlyphRasterizer &&)      = delete;
+
+            /// @brief Default number of bytes of glyphs uploaded per frame.
+            static constexpr size_t DEFAULT_UPLOAD_BUDGET = 0x40000;
+
+            /// @brief Queues the codepoints passed that the glyph set doesn't have cached yet.
+            /// @param glyphSet Glyph set to rasterize the codepoints for.
+            /// @param codepoints Codepoints to rasterize.
+            static void queue(const std::shared_ptr<sdl2::GlyphSet> &glyphSet, std::span<const uint32_t> codepoints);
+
+            /// @brief Returns the number of glyph batches waiting to be rasterized or uploaded.
+            static size_t get_pending_count();
+
+            /// @brief Sets the number of bytes of glyphs uploaded per frame. At least one batch is uploaded per frame
+            /// regardless.
+            /// @param bytes Budget in bytes.
+            static void set_upload_budget(size_t bytes);
+
+            /// @brief Sets the number of worker threads rasterizing glyphs. Only has an effect before the first queue.
+            /// @param count Number of workers.
+            static void set_worker_count(size_t count);
+
+            /// @brief Uploads rasterized glyphs until the budget for the frame runs out. Called by Renderer::frame_begin.
+            static void process_uploads();
+
+            /// @brief Blocks until every queued glyph is rasterized and uploads them all regardless of the budget.
+            /// @note Meant for loading screens and prewarming before the first frame.
+            static void finish_pending();
+
+        private:
+            // clang-format off
+            /// @brief Glyphs waiting to be rasterized.
+            struct RasterJob
+            {
+                std::shared_ptr<sdl2::GlyphSet> glyphSet{};
+                std::vector<uint32_t> codepoints{};
+            };
+
+            /// @brief Single rasterized glyph.
+            struct RasterizedGlyph
+            {
+                uint32_t codepoint{};
+                sdl2::GlyphData glyphData{};
+                sdl2::Surface surface{nullptr, SDL_FreeSurface};
+            };
+
+            /// @brief Rasterized glyphs of a job waiting to be uploaded.
+            struct RasterizedBatch
+            {
+                std::shared_ptr<sdl2::GlyphSet> glyphSet{};
+                std::vector<GlyphRasterizer::RasterizedGlyph> glyphs{};
+            };
+
+            /// @brief Face a worker created from a FontFace's data at a pixel size.
+            struct WorkerFace
+            {
+                std::weak_ptr<sdl2::FontFace> source{};
+                int pixelSize{};
+                FT_Face face{};
+            };
+            // clang-format on
+
+            /// @brief Number of codepoints rasterized per job. Large charsets are split so every worker gets a share.
+            static constexpr size_t GLYPHS_PER_JOB = 64;
+
+            /// @brief Number of batches that haven't been uploaded yet. Only touched by the render thread.
+            size_t m_pendingCount{};
+
+            /// @brief Bytes uploaded per frame.
+            size_t m_uploadBudget{DEFAULT_UPLOAD_BUDGET};
+
+            /// @brief Guards the queues and exit flag below.
+            std::mutex m_queueLock{};
+
+            /// @brief Wakes the workers when there's something to rasterize.
+            std::condition_variable m_queueCondition{};
+
+            /// @brief Wakes finish_pending when something was rasterized.
+            std::condition_variable m_uploadCondition{};
+
+            /// @brief Glyphs waiting to be rasterized.
+            std::deque<GlyphRasterizer::RasterJob> m_rasterQueue{};
+
+            /// @brief Rasterized glyphs waiting to be uploaded.
+            std::deque<GlyphRasterizer::RasterizedBatch> m_uploadQueue{};
+
+            /// @brief Tells the workers to exit.
+            bool m_exitWorker{};
+
+            /// @brief Number of workers to start. Defaults to every core but the render thread's.
+            size_t m_workerCount{std::max<size_t>(std::thread::hardware_concurrency(), 2) - 1};
+
+            /// @brief Worker threads. Started the first time something is queued.
+            std::vector<std::thread> m_workers{};
+
+            /// @brief Private constructor.
+            GlyphRasterizer() = default;
+
+            /// @brief Stops the workers.
+            ~GlyphRasterizer();
+
+            /// @brief Returns the instance.
+            static GlyphRasterizer &get_instance();
+
+            /// @brief Uploads rasterized glyphs until the budget passed runs out.
+            /// @param budget Number of bytes to upload.
+            void upload(size_t budget);
+
+            /// @brief Rasterizes glyphs until told to exit.
+            void worker_main();
+
+            /// @brief Rasterizes the glyphs of the job passed with the library passed.
+            /// @param library Worker's library.
+            /// @param faces Worker's faces.
+            /// @param job Job to rasterize.
+            /// @return Batch of rasterized glyphs.
+            static GlyphRasterizer::RasterizedBatch rasterize_job(FT_Library library,
+                                                                  std::vector<GlyphRasterizer::WorkerFace> &faces,
+                                                                  GlyphRasterizer::RasterJob &job);
+
+            /// @brief Returns the worker's face for the FontFace and pixel size passed, creating it if needed.
+            /// @param library Worker's library.
+            /// @param faces Worker's faces.
+            /// @param source FontFace to create the face from.
+            /// @param pixelSize Pixel size to set the face to.
+            /// @return Face on success. nullptr on failure.
+            static FT_Face find_create_face(FT_Library library,
+                                            std::vector<GlyphRasterizer::WorkerFace> &faces,
+                                            const std::shared_ptr<sdl2::FontFace> &source,
+                                            int pixelSize);
+
+            /// @brief Frees the worker's faces whose FontFace was destroyed. Their data might not exist anymore.
+            /// @param faces Worker's faces.
+            static void free_expired_faces(std::vector<GlyphRasterizer::WorkerFace> &faces);
+    };
+}
\ No newline at end of file
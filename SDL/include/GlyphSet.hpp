@@ -0,0 +1,151 @@
+#pragma once
+#include "CoreComponent.hpp"
+#include "FontFace.hpp"
+#include "GlyphCache.hpp"
+#include "OptionalReference.hpp"
+#include "Surface.hpp"
+#include "TextureAtlas.hpp"
+
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace sdl2
+{
+    /// @brief Glyphs of a list of faces rendered at one pixel size. Every font using the same faces at the same size shares
+    /// one of these through the FontRegistry.
+    /** @note
+     *  Each face gets its own FT_Size for this set, so the faces themselves are only created once no matter how many sizes
+     *  are used. Codepoints are looked up in the faces in order and the first face containing one is used. Which face that
+     *  is comes from a coverage index built once per set, and codepoints no face has are cached as missing.
+     */
+    class GlyphSet final : public sdl2::CoreComponent
+    {
+        public:
+            // No copying or moving.
+            GlyphSet(const GlyphSet &)            = delete;
+            GlyphSet(GlyphSet &&)                 = delete;
+            GlyphSet &operator=(const GlyphSet &) = delete;
+            GlyphSet &operator=(GlyphSet &&)      = delete;
+
+            /// @brief Creates a size for each face passed.
+            /// @param faces Faces to render glyphs from.
+            /// @param pixelSize Size of the glyphs in pixels.
+            GlyphSet(std::span<const std::shared_ptr<sdl2::FontFace>> faces, int pixelSize);
+
+            /// @brief Frees the sizes created for the faces.
+            ~GlyphSet();
+
+            /// @brief Searches the cache for the codepoint passed or loads it if needed.
+            /// @param codepoint Codepoint to find or load.
+            /// @return Reference to the glyph data for the code point. Only valid until the next glyph is loaded.
+            /// @note This is defined here so hits can be inlined into the text loops.
+            OptionalReference<const sdl2::GlyphData> find_load_glyph(uint32_t codepoint)
+            {
+                const sdl2::GlyphData *cachedGlyph = m_glyphCache.find(codepoint);
+                if (!cachedGlyph) { return GlyphSet::load_glyph(codepoint); }
+                else if (cachedGlyph->page == sdl2::GlyphData::MISSING_PAGE) { return std::nullopt; }
+                else if (cachedGlyph->page == sdl2::GlyphData::PENDING_PAGE)
+                {
+                    // Glyphs still rasterizing in the background are skipped instead of stalling the frame.
+                    m_skippedPending = true;
+                    return std::nullopt;
+                }
+
+                return *cachedGlyph;
+            }
+
+            /// @brief Marks the codepoints passed that aren't cached yet as pending. They're skipped until they land.
+            /// @param codepoints Codepoints to claim.
+            /// @return Codepoints claimed. Each needs to be passed to insert_rasterized eventually.
+            std::vector<uint32_t> claim_pending(std::span<const uint32_t> codepoints);
+
+            /// @brief Packs a glyph rasterized in the background into the atlas and caches it in place of its pending entry.
+            /// @param codepoint Codepoint of the glyph.
+            /// @param glyphData Metrics of the glyph. Glyphs marked missing are cached as such.
+            /// @param surface Rasterized glyph. Empty for glyphs without pixels like spaces.
+            void insert_rasterized(uint32_t codepoint, sdl2::GlyphData glyphData, sdl2::Surface &surface);
+
+            /// @brief Returns a number that changes when glyphs that were skipped while pending land. Layouts built
+            /// before then are missing them.
+            uint32_t get_generation() const noexcept;
+
+            /// @brief Returns the faces of the set. These never change, so this is safe to call from any thread.
+            std::span<const std::shared_ptr<sdl2::FontFace>> get_faces() const noexcept;
+
+            /// @brief Returns the index of the face that renders the codepoint passed. Safe to call from any thread.
+            /// @param codepoint Codepoint to search for.
+            /// @return Index of the face. nullopt if no face has the codepoint.
+            std::optional<size_t> find_face(uint32_t codepoint) const noexcept;
+
+            /// @brief Returns the atlas page at the index passed.
+            /// @param page Index of the page.
+            const std::shared_ptr<sdl2::Texture> &get_page(int page) const noexcept;
+
+            /// @brief Returns the pixel size of the glyphs.
+            int get_pixel_size() const noexcept;
+
+            /// @brief Returns the memory used by the atlas pages in bytes.
+            size_t get_glyph_byte_size() const noexcept;
+
+            /// @brief Converts the glyph slot passed to glyph data and an ARGB surface of its coverage.
+            /// @param glyphSlot Slot containing the rendered glyph.
+            /// @param glyphData Glyph data to write the metrics to.
+            /// @param surface Surface to write the glyph to. Left empty for glyphs without pixels.
+            /// @return True on success. False if the surface couldn't be created.
+            /// @note This doesn't touch the set, so workers use it too.
+            static bool rasterize(const FT_GlyphSlot glyphSlot, sdl2::GlyphData &glyphData, sdl2::Surface &surface);
+
+        private:
+            // clang-format off
+            /// @brief Run of codepoints resolved to the face that renders them.
+            struct FaceRange
+            {
+                uint32_t first{};
+                uint32_t last{};
+                uint32_t face{};
+            };
+            // clang-format on
+
+            /// @brief Width and height of the glyph atlas pages.
+            static constexpr int GLYPH_PAGE_SIZE = 512;
+
+            /// @brief Faces glyphs are rendered from. These are held so they outlive their sizes.
+            std::vector<std::shared_ptr<sdl2::FontFace>> m_faces{};
+
+            /// @brief Size created for each face.
+            std::vector<FT_Size> m_sizes{};
+
+            /// @brief Sorted, non-overlapping ranges of codepoints and the first face covering them.
+            std::vector<GlyphSet::FaceRange> m_coverage{};
+
+            /// @brief Pixel size of the glyphs.
+            int m_pixelSize{};
+
+            /// @brief Cache of glyph data.
+            sdl2::GlyphCache m_glyphCache{};
+
+            /// @brief Atlas glyphs are rasterized to. Text is drawn from a handful of pages instead of a texture per glyph.
+            sdl2::TextureAtlas m_glyphAtlas{GLYPH_PAGE_SIZE, GLYPH_PAGE_SIZE};
+
+            /// @brief Incremented when glyphs that were skipped while pending land.
+            uint32_t m_generation{};
+
+            /// @brief Whether or not a pending glyph was skipped since the generation was last bumped.
+            bool m_skippedPending{};
+
+            /// @brief Merges the coverage of the faces into m_coverage. Earlier faces win where they overlap.
+            void build_coverage();
+
+            /// @brief Loads the glyph for the codepoint passed from the first face that has it and caches it.
+            /// @param codepoint Codepoint to load.
+            OptionalReference<const sdl2::GlyphData> load_glyph(uint32_t codepoint);
+
+            /// @brief Rasterizes the glyph slot passed and packs its bitmap into the glyph atlas.
+            /// @param glyphSlot Slot containing the rendered glyph.
+            /// @param glyphData Glyph data to write to.
+            /// @return True on success. False on failure.
+            bool pack_glyph(const FT_GlyphSlot glyphSlot, sdl2::GlyphData &glyphData);
+    };
+}
\ No newline at end of file
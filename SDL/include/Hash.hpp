@@ -0,0 +1,25 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+namespace sdl2
+{
+    /// @brief FNV-1a offset basis and prime.
+    static constexpr uint64_t FNV1A_OFFSET_BASIS = 0xCBF29CE484222325;
+    static constexpr uint64_t FNV1A_PRIME        = 0x00000100000001B3;
+
+    /// @brief Returns the 64 bit FNV-1a hash of the string passed.
+    /// @param string String to hash.
+    /// @note This has no dependencies so host tools can use it too.
+    constexpr uint64_t fnv1a_64(std::string_view string) noexcept
+    {
+        uint64_t hash = FNV1A_OFFSET_BASIS;
+        for (const char character : string)
+        {
+            hash ^= static_cast<uint8_t>(character);
+            hash *= FNV1A_PRIME;
+        }
+
+        return hash;
+    }
+}
\ No newline at end of file
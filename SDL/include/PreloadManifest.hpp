@@ -0,0 +1,40 @@
+#pragma once
+#include "ResourceManager.hpp"
+
+#include <string_view>
+#include <vector>
+
+namespace sdl2
+{
+    /// @brief Preloads the textures a previous run requested during startup and records the ones this run requests.
+    /** @note
+     *  The manifest is a text file with one texture per line: its name, a tab and its path. Only textures requested
+     *  with a path are written. Preloaded textures are decoded in parallel by the TextureLoader workers.
+     */
+    class PreloadManifest final
+    {
+        public:
+            /// @brief Default constructor.
+            PreloadManifest() = default;
+
+            /// @brief Queues every texture in the manifest to load in the background.
+            /// @param manifestPath Path of the manifest.
+            /// @return Number of textures queued. 0 if the manifest doesn't exist yet.
+            size_t preload(std::string_view manifestPath);
+
+            /// @brief Blocks until every texture queued by preload is ready.
+            void wait();
+
+            /// @brief Releases the preloaded textures. Anything still in use elsewhere stays loaded.
+            void release();
+
+            /// @brief Writes the textures requested while the TextureManager was recording to a manifest.
+            /// @param manifestPath Path to write to.
+            /// @return True on success. False on failure.
+            static bool write(std::string_view manifestPath);
+
+        private:
+            /// @brief Textures preloaded. Held so they stay loaded until they're requested.
+            std::vector<sdl2::SharedTexture> m_textures{};
+    };
+}
\ No newline at end of file
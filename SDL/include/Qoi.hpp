@@ -0,0 +1,38 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <cstddef>
+#include <string_view>
+
+namespace sdl2
+{
+    /// @brief Built in decoder for QOI images. They decode many times faster than PNG for similar sizes.
+    /** @note
+     *  Decoded surfaces are ARGB8888, the same format textures are created in, so uploading them doesn't need a
+     *  conversion. Surfaces returned are owned by the caller.
+     */
+    namespace qoi
+    {
+        /// @brief Extension QOI files use.
+        inline constexpr std::string_view EXTENSION = ".qoi";
+
+        /// @brief Returns whether or not the file path passed ends in the QOI extension.
+        /// @param filePath Path to check.
+        bool has_extension(std::string_view filePath) noexcept;
+
+        /// @brief Returns whether or not the data passed starts with the QOI magic.
+        /// @param data Data to check.
+        /// @param dataSize Size of the data.
+        bool is_qoi(const void *data, size_t dataSize) noexcept;
+
+        /// @brief Decodes the QOI image passed.
+        /// @param data QOI data.
+        /// @param dataSize Size of the data.
+        /// @return Surface on success. nullptr on failure.
+        SDL_Surface *decode(const void *data, size_t dataSize);
+
+        /// @brief Loads and decodes the QOI file passed.
+        /// @param filePath Path to load.
+        /// @return Surface on success. nullptr on failure.
+        SDL_Surface *load(std::string_view filePath);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+#pragma once
+#include "Renderer.hpp"
+#include "Texture.hpp"
+
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <memory>
+
+namespace sdl2
+{
+    /// @brief Renders a block of content to a target texture once and re-blits it until it's invalidated.
+    /** @note
+     *  The target is created the first time the cache is rendered, so instances can be members of classes constructed
+     *  before Texture::initialize() is called.
+     */
+    class RenderCache final
+    {
+        public:
+            /// @brief Creates a new render cache.
+            /// @param width Width of the cached area.
+            /// @param height Height of the cached area.
+            RenderCache(int width, int height);
+
+            /// @brief Marks the cached content as stale. It's redrawn the next time the cache is rendered.
+            void invalidate() noexcept;
+
+            /// @brief Returns whether or not the cached content is up to date.
+            bool is_valid() const noexcept;
+
+            /// @brief Returns the width of the cached area.
+            int get_width() const noexcept;
+
+            /// @brief Returns the height of the cached area.
+            int get_height() const noexcept;
+
+            /// @brief Renders the cached content, redrawing it first if it was invalidated.
+            /// @param renderer Renderer to use.
+            /// @param x X coordinate.
+            /// @param y Y coordinate.
+            /// @param draw Function that draws the content. Coordinates are relative to the top left of the cache.
+            template <typename Function>
+            bool render(sdl2::Renderer &renderer, int x, int y, Function &&draw)
+            {
+                if (!m_isValid && !RenderCache::redraw(renderer, std::forward<Function>(draw))) { return false; }
+
+                return m_target->render(x, y);
+            }
+
+            /// @brief Renders the cached content, redrawing it first if it was invalidated or the content hash changed.
+            /// @param renderer Renderer to use.
+            /// @param x X coordinate.
+            /// @param y Y coordinate.
+            /// @param contentHash Hash of whatever the content is drawn from.
+            /// @param draw Function that draws the content. Coordinates are relative to the top left of the cache.
+            template <typename Function>
+            bool render(sdl2::Renderer &renderer, int x, int y, uint64_t contentHash, Function &&draw)
+            {
+                if (m_contentHash != contentHash)
+                {
+                    m_contentHash = contentHash;
+                    m_isValid     = false;
+                }
+
+                return RenderCache::render(renderer, x, y, std::forward<Function>(draw));
+            }
+
+        private:
+            /// @brief Width of the cache.
+            int m_width{};
+
+            /// @brief Height of the cache.
+            int m_height{};
+
+            /// @brief Whether or not the content is up to date.
+            bool m_isValid{};
+
+            /// @brief Hash of the content currently cached.
+            uint64_t m_contentHash{};
+
+            /// @brief Target the content is rendered to.
+            std::shared_ptr<sdl2::Texture> m_target{};
+
+            /// @brief Creates the target if needed, pushes it and clears it.
+            bool begin_redraw(sdl2::Renderer &renderer);
+
+            /// @brief Pops the target and marks the content as valid.
+            bool end_redraw(sdl2::Renderer &renderer);
+
+            /// @brief Redraws the content to the target.
+            template <typename Function>
+            bool redraw(sdl2::Renderer &renderer, Function &&draw)
+            {
+                if (!RenderCache::begin_redraw(renderer)) { return false; }
+
+                draw();
+
+                return RenderCache::end_redraw(renderer);
+            }
+    };
+}
\ No newline at end of file
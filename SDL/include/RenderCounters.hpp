@@ -0,0 +1,122 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <unordered_set>
+
+// Counters are only compiled in with SDL2_COUNTERS_ENABLED, which the debug library is built with. Release builds get
+// empty macros and zeroed results. The class looks the same either way, so code built without the flag still links
+// against a debug library. It just doesn't count anything itself, such as the resource manager templates it instantiates.
+#ifdef SDL2_COUNTERS_ENABLED
+    /// @brief Increments the counter passed for the current frame. Render thread only.
+    #define SDL2_COUNT(counter) (sdl2::RenderCounters::count(&sdl2::FrameCounters::counter))
+
+    /// @brief Increments the resource counter passed. Safe from any thread.
+    #define SDL2_COUNT_RESOURCE(counter) (sdl2::RenderCounters::count_resource(sdl2::RenderCounters::Resource::counter))
+
+    /// @brief Records the texture passed being bound for a draw.
+    #define SDL2_COUNT_TEXTURE_BIND(texture) (sdl2::RenderCounters::bind_texture(texture))
+#else
+    #define SDL2_COUNT(counter) static_cast<void>(0)
+    #define SDL2_COUNT_RESOURCE(counter) static_cast<void>(0)
+    #define SDL2_COUNT_TEXTURE_BIND(texture) static_cast<void>(0)
+#endif
+
+namespace sdl2
+{
+    // clang-format off
+    /// @brief Hard numbers for a single frame.
+    struct FrameCounters
+    {
+        /// @brief Immediate SDL_RenderCopy calls.
+        uint32_t renderCopies{};
+
+        /// @brief SDL_RenderGeometry calls made flushing the sprite batch.
+        uint32_t geometryCalls{};
+
+        /// @brief Quads queued in the sprite batch.
+        uint32_t batchedQuads{};
+
+        /// @brief Texture draws rejected because they were fully outside the visible area.
+        uint32_t culledDraws{};
+
+        /// @brief Number of different textures drawn from.
+        uint32_t distinctTextures{};
+
+        /// @brief Number of times the texture changed between two draws.
+        uint32_t textureSwitches{};
+
+        /// @brief Number of times the render target actually changed.
+        uint32_t targetSwitches{};
+
+        /// @brief Rectangles and lines drawn.
+        uint32_t primitives{};
+
+        /// @brief Glyphs that weren't cached and had to be rasterized.
+        uint32_t glyphCacheMisses{};
+
+        /// @brief Resources created by the resource managers.
+        uint32_t resourcesCreated{};
+
+        /// @brief Expired resources purged by the resource managers.
+        uint32_t resourcesPurged{};
+    };
+    // clang-format on
+
+    /// @brief Per-frame counters incremented on the library's hot paths.
+    /** @note
+     *  Renderer::frame_begin() ends the previous frame. Everything is a no-op unless the library was built with
+     *  SDL2_COUNTERS_ENABLED. When it wasn't, get_last_frame() always returns zeroes.
+     */
+    class RenderCounters final
+    {
+        public:
+            /// @brief Counters the resource managers increment from any thread.
+            enum class Resource : uint8_t
+            {
+                Created,
+                Purged,
+                Count
+            };
+
+            // No constructing.
+            RenderCounters() = delete;
+
+            /// @brief Returns the counters of the last complete frame.
+            static sdl2::FrameCounters get_last_frame() noexcept;
+
+            /// @brief Returns whether or not the counters were compiled into the library.
+            static bool is_enabled() noexcept;
+
+            /// @brief Ends the current frame and resets the counters. Called by Renderer::frame_begin.
+            static void end_frame() noexcept;
+
+            /// @brief Increments a counter of the frame in progress.
+            /// @param counter Counter to increment.
+            static void count(uint32_t sdl2::FrameCounters::*counter) noexcept;
+
+            /// @brief Increments a resource counter. These are atomic since resources are loaded from worker threads too.
+            /// @param counter Counter to increment.
+            static void count_resource(RenderCounters::Resource counter) noexcept;
+
+            /// @brief Records a texture being bound for a draw.
+            /// @param texture Texture being drawn from.
+            static void bind_texture(const void *texture);
+
+        private:
+            /// @brief Counters of the frame in progress.
+            static sdl2::FrameCounters sm_currentFrame;
+
+            /// @brief Counters of the last complete frame.
+            static sdl2::FrameCounters sm_lastFrame;
+
+            /// @brief Resource counts of the frame in progress. Moved into the frame's counters when it ends.
+            static std::array<std::atomic<uint32_t>, static_cast<size_t>(RenderCounters::Resource::Count)> sm_resourceCounts;
+
+            /// @brief Last texture drawn from.
+            static const void *sm_lastTexture;
+
+            /// @brief Every texture drawn from this frame.
+            static std::unordered_set<const void *> sm_frameTextures;
+    };
+}
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace sdl2
+{
+    /// @brief Forward declaration to prevent clashes.
+    class Texture;
+
+    /// @brief Pool of reusable render target textures keyed by size and format.
+    /** @note
+     *  A target is free again once the pool holds the only reference to it. Creating SDL_TEXTUREACCESS_TARGET textures
+     *  is expensive, so offscreen rendering done every frame should go through the pool.
+     */
+    class RenderTargetPool final
+    {
+        public:
+            /// @brief Default constructor.
+            RenderTargetPool() = default;
+
+            /// @brief Returns a free target matching the arguments passed, creating one if none are free.
+            /// @param width Width of the target.
+            /// @param height Height of the target.
+            /// @param format Pixel format of the target.
+            /// @return Target on success. nullptr on failure.
+            /// @note Targets are set to the premultiplied blend mode and reused ones have their color mod reset, but their
+            /// content is left as is.
+            std::shared_ptr<sdl2::Texture> acquire(int width, int height, uint32_t format = SDL_PIXELFORMAT_ARGB8888);
+
+            /// @brief Destroys every target that isn't in use.
+            void trim();
+
+            /// @brief Releases every target. Targets still in use elsewhere live on until they're released there.
+            void clear();
+
+            /// @brief Returns the number of targets in the pool.
+            size_t get_size() const noexcept;
+
+        private:
+            // clang-format off
+            /// @brief Pooled target and the key it was created with.
+            struct PooledTarget
+            {
+                int width{};
+                int height{};
+                uint32_t format{};
+                std::shared_ptr<sdl2::Texture> texture{};
+            };
+            // clang-format on
+
+            /// @brief Targets created by the pool.
+            std::vector<RenderTargetPool::PooledTarget> m_targets{};
+    };
+}
\ No newline at end of file
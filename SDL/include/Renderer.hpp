@@ -1,9 +1,14 @@
 #pragma once
 #include "CoreComponent.hpp"
+#include "FrameProfiler.hpp"
+#include "RenderTargetPool.hpp"
+#include "SpriteBatch.hpp"
 #include "Window.hpp"
 
 #include <SDL2/SDL.h>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <stack>
 
 namespace sdl2
@@ -34,6 +39,12 @@ namespace sdl2
             /// @param height Height of the renderer.
             bool set_logical_presentation(int width, int height);
 
+            /// @brief Returns the logical width set. 0 if one hasn't been set.
+            int get_logical_width() const noexcept;
+
+            /// @brief Returns the logical height set. 0 if one hasn't been set.
+            int get_logical_height() const noexcept;
+
             /// @brief Sets the render clipping area.
             /// @param x X of the area.
             /// @param y Y of the area.
@@ -41,14 +52,64 @@ namespace sdl2
             /// @param height Height of the area.
             bool set_render_clip(int x, int y, int width, int height);
 
+            /// @brief Disables render clipping.
+            bool disable_render_clip();
+
             /// @brief Sets the render target.
             /// @param target Target to render to.
             /// @return True on success. False on failure.
             bool set_render_target(std::shared_ptr<sdl2::Texture> target);
 
+            /// @brief Pushes a render target onto the target stack and begins rendering to it.
+            /// @param target Target to render to.
+            /// @return True on success. False on failure.
+            /// @note The clip rectangle and logical size are saved and restored when the target is popped.
+            bool push_render_target(std::shared_ptr<sdl2::Texture> target);
+
+            /// @brief Pops the current render target and resumes rendering to the one before it.
+            /// @return True on success. False on failure.
+            bool pop_render_target();
+
+            /// @brief Returns the pool of reusable render targets.
+            sdl2::RenderTargetPool &get_target_pool() noexcept;
+
+            /// @brief Clears the current render target to the color passed.
+            /// @param color Color to clear with.
+            bool clear(SDL_Color color);
+
             /// @brief Sets the render color to the color passed.
             bool set_draw_color(SDL_Color color);
 
+            /// @brief Sets the blend mode used for primitives.
+            /// @param mode Mode to set.
+            bool set_draw_blend_mode(SDL_BlendMode mode);
+
+            /// @brief Returns the number of SDL state calls skipped because the value didn't change.
+            uint64_t get_skipped_state_changes() const noexcept;
+
+            /// @brief Returns the area of the current target that can be drawn to, accounting for the clip rectangle and
+            /// logical size. nullopt if it isn't known, in which case nothing is culled.
+            std::optional<SDL_Rect> get_visible_rect() const noexcept;
+
+            /// @brief Returns whether or not any part of the rectangle passed would be visible.
+            /// @param rect Rectangle to test.
+            bool is_visible(const SDL_Rect &rect) const noexcept;
+
+            /// @brief Returns the number of texture draws rejected because they were fully outside the visible area.
+            uint64_t get_culled_draws() const noexcept;
+
+            /// @brief Enables or disables sprite batching. While enabled, texture renders are queued and submitted with
+            /// SDL_RenderGeometry instead of a SDL_RenderCopy each.
+            /// @param enabled Whether or not batching should be enabled.
+            void set_batching(bool enabled);
+
+            /// @brief Returns whether or not sprite batching is enabled.
+            bool is_batching() const noexcept;
+
+            /// @brief Submits anything queued in the sprite batch.
+            /// @return True on success. False on failure.
+            bool flush_batch();
+
             /// @brief Begins the frame and clears the target to the color passed.
             /// @param clearColor Color to clear the target with.
             bool frame_begin(SDL_Color clearColor);
@@ -56,6 +117,9 @@ namespace sdl2
             /// @brief Ends the render process and presents the target.
             void frame_end();
 
+            /// @brief Returns the frame profiler driven by frame_begin and frame_end.
+            sdl2::FrameProfiler &get_frame_profiler() noexcept;
+
             /// @brief Renders a rectangle using the arguments passed.
             bool render_rectangle(int x, int y, int width, int height, SDL_Color color);
 
@@ -69,7 +133,76 @@ namespace sdl2
             /// @brief SDL Renderer.
             SDL_Renderer *m_renderer{};
 
-            /// @brief This is a  workaround for JKSV more or less.
-            std::stack<std::shared_ptr<sdl2::Texture>> m_targetStack{};
+            /// @brief Sprite batch used when batching is enabled.
+            sdl2::SpriteBatch m_spriteBatch{};
+
+            /// @brief Whether or not texture renders should be batched.
+            bool m_batching{};
+
+            /// @brief Frame timing profiler.
+            sdl2::FrameProfiler m_frameProfiler{};
+
+            /// @brief Last draw color set. nullopt if it isn't known.
+            std::optional<SDL_Color> m_drawColor{};
+
+            /// @brief Last draw blend mode set.
+            std::optional<SDL_BlendMode> m_drawBlendMode{};
+
+            /// @brief Last clip rectangle set. An empty rectangle means clipping is disabled, same as SDL.
+            std::optional<SDL_Rect> m_clipRect{};
+
+            /// @brief Target currently being rendered to. nullptr is the frame buffer.
+            SDL_Texture *m_currentTarget{};
+
+            /// @brief Size of the current target. 0 for the frame buffer.
+            int m_targetWidth{};
+            int m_targetHeight{};
+
+            /// @brief Area of the current target that can be drawn to. nullopt if it isn't known.
+            std::optional<SDL_Rect> m_visibleRect{};
+
+            /// @brief Number of texture draws culled.
+            uint64_t m_culledDraws{};
+
+            /// @brief Number of state changes skipped by the Renderer and Texture.
+            uint64_t m_skippedStateChanges{};
+
+            /// @brief Logical size set with set_logical_presentation.
+            int m_logicalWidth{};
+            int m_logicalHeight{};
+
+            // clang-format off
+            /// @brief Pushed target and the state to restore once it's popped.
+            struct TargetState
+            {
+                std::shared_ptr<sdl2::Texture> target{};
+                std::optional<SDL_Rect> clipRect{};
+                int logicalWidth{};
+                int logicalHeight{};
+            };
+            // clang-format on
+
+            /// @brief Stack of render targets. The frame buffer is used when it's empty.
+            std::stack<Renderer::TargetState> m_targetStack{};
+
+            /// @brief Pool of reusable render targets.
+            sdl2::RenderTargetPool m_targetPool{};
+
+            /// @brief Renders or queues a textured quad depending on whether batching is enabled.
+            /// @param texture Texture to render.
+            /// @param textureWidth Width of the texture.
+            /// @param textureHeight Height of the texture.
+            /// @param colorMod Color and alpha mod of the texture.
+            /// @param source Source rectangle.
+            /// @param destination Destination rectangle.
+            bool render_copy(SDL_Texture *texture,
+                             int textureWidth,
+                             int textureHeight,
+                             SDL_Color colorMod,
+                             const SDL_Rect &source,
+                             const SDL_Rect &destination);
+
+            /// @brief Recalculates the visible area after the target, clip rectangle or logical size changes.
+            void update_visible_rect();
     };
 }
\ No newline at end of file
@@ -1,11 +1,23 @@
 #pragma once
 #include "Font.hpp"
+#include "Hash.hpp"
+#include "RenderCounters.hpp"
 #include "Sound.hpp"
 #include "Texture.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <tuple>
 #include <unordered_map>
+#include <vector>
 
 namespace sdl2
 {
@@ -18,8 +30,89 @@ namespace sdl2
     /// @brief Shared sound definition.
     using SharedSound = std::shared_ptr<Sound>;
 
+    /// @brief Precomputed hash of a resource name.
+    using ResourceId = uint64_t;
+
+    /// @brief Returns the ID of the resource name passed. Usable at compile time.
+    /// @param name Name of the resource.
+    constexpr sdl2::ResourceId resource_id(std::string_view name) noexcept { return sdl2::fnv1a_64(name); }
+
+    // clang-format off
+    /// @brief Generational index into a resource manager's slots.
+    struct ResourceHandle
+    {
+        /// @brief Index of the slot.
+        uint32_t index{};
+
+        /// @brief Generation of the slot when the handle was created. 0 is never a valid generation.
+        uint32_t generation{};
+
+        /// @brief Returns whether or not the handle was ever assigned. Released handles still need to go through get.
+        constexpr bool is_valid() const noexcept { return generation != 0; }
+    };
+
+    /// @brief Resource requested while recording.
+    struct ResourceRecord
+    {
+        /// @brief Name the resource was requested with.
+        std::string name{};
+
+        /// @brief Path it was loaded from. Empty if the first constructor argument wasn't a path.
+        std::string path{};
+    };
+
+    /// @brief Snapshot of what a resource manager holds and how its lookups went.
+    struct ResourceStats
+    {
+        /// @brief Names in the map, including expired ones and ones still loading.
+        size_t entryCount{};
+
+        /// @brief Entries whose resource is still alive.
+        size_t liveCount{};
+
+        /// @brief Entries whose resource was freed and are waiting to be purged.
+        size_t expiredCount{};
+
+        /// @brief Requests that found their resource alive.
+        uint64_t hits{};
+
+        /// @brief Requests that didn't. Requests that waited on another thread's load count here too.
+        uint64_t misses{};
+
+        /// @brief Resources constructed.
+        uint64_t creates{};
+
+        /// @brief Estimated size of the live resources in bytes.
+        size_t liveBytes{};
+
+        /// @brief Handles currently assigned.
+        size_t handleCount{};
+
+        /// @brief Resources held by the cache.
+        size_t cachedCount{};
+
+        /// @brief Estimated size of the resources held by the cache in bytes.
+        size_t cachedBytes{};
+    };
+
+    /// @brief Size and name of a single live resource.
+    struct ResourceUsage
+    {
+        /// @brief Name of the resource.
+        std::string name{};
+
+        /// @brief Estimated size in bytes.
+        size_t bytes{};
+
+        /// @brief Number of references to the resource outside of the manager's map.
+        long useCount{};
+    };
+    // clang-format on
+
     /// @brief Templated, generic resource manager.
     /// @tparam ResourceType Type of resource being used.
+    /// @note Every function can be called from any thread. The manager only guards its own state, so resources like
+    /// textures still need to be created on the thread that owns what they depend on.
     template <typename ResourceType>
     class ResourceManager final
     {
@@ -33,69 +126,340 @@ namespace sdl2
             /// @brief Templated resource creation/loading function that passed parameters to the constructor.
             /// @param name Internal "name" of the resource.
             /// @param ...args Variadic arguments to forward to the constructor.
+            /// @note If another thread is already creating a resource with the same name, this waits for it and returns
+            /// the same resource instead of creating a second one.
             template <typename... Args>
             static std::shared_ptr<ResourceType> create_load_resource(std::string_view name, Args &&...args)
             {
-                // Grab the instance.
+                return ResourceManager::find_or_create<ResourceType>(name, std::forward<Args>(args)...);
+            }
+
+            /// @brief Templated function to allow derived resources for the managers.
+            /// @tparam Type Derived resource type.
+            /// @tparam ...Args Arguments to forward.
+            /// @param name Name of the resource.
+            template <typename Type, typename... Args>
+            static std::shared_ptr<ResourceType> create_load_resource(std::string_view name, Args &&...args)
+            {
+                // Assert this so no surprises.
+                static_assert(std::derived_from<Type, ResourceType> == true, "ResourceManager: Type is not derived from base.");
+
+                return ResourceManager::find_or_create<Type>(name, std::forward<Args>(args)...);
+            }
+
+            /// @brief Returns a handle to the resource with the ID passed, loading it through create_load_resource if needed.
+            /// @tparam Type Type to construct. Can be derived from the resource type.
+            /// @param id ID of the name. Pass a constant from resource_id so the name isn't hashed at runtime.
+            /// @param name Name of the resource.
+            /// @param ...args Arguments to forward to the constructor.
+            /// @note The slot holds the resource until the handle is released, so lookups don't need to touch a
+            /// reference count. Invalid if every slot is in use.
+            template <typename Type = ResourceType, typename... Args>
+            static sdl2::ResourceHandle load_handle(sdl2::ResourceId id, std::string_view name, Args &&...args)
+            {
+                const sdl2::ResourceHandle handle = ResourceManager::find_handle(id);
+                if (handle.is_valid()) { return handle; }
+
+                std::shared_ptr<ResourceType> resource =
+                    ResourceManager::create_load_resource<Type>(name, std::forward<Args>(args)...);
+
+                return ResourceManager::get_instance().assign_slot(id, std::move(resource));
+            }
+
+            /// @brief Returns the handle to the resource with the ID passed. Invalid if there isn't one.
+            /// @param id ID of the resource.
+            static sdl2::ResourceHandle find_handle(sdl2::ResourceId id)
+            {
                 ResourceManager &instance = ResourceManager::get_instance();
+                std::shared_lock<std::shared_mutex> slotLock{instance.m_slotLock};
 
-                // Run purge routine.
-                instance.purge_expired();
+                const auto findSlot = instance.m_slotMap.find(id);
+                if (findSlot == instance.m_slotMap.end()) { return {}; }
 
-                // Reference to map.
-                auto &resourceMap = instance.m_resourceMap;
+                const uint32_t index = findSlot->second;
+                return {.index = index, .generation = instance.find_slot(index)->generation.load(std::memory_order_relaxed)};
+            }
 
-                // Search for resource.
-                const auto &findResource = resourceMap.find(name);
-                if (findResource != resourceMap.end() && !findResource->second.expired())
+            /// @brief Returns the resource the handle points to.
+            /// @param handle Handle to the resource.
+            /// @return Pointer to the resource. nullptr if the handle was released or is invalid.
+            /// @note The pointer is only valid until the handle is released. This doesn't lock anything or write to shared
+            /// memory. Slots never move, and the generation is read on both sides of the pointer so a slot released in
+            /// between isn't mistaken for a live one.
+            static ResourceType *get(sdl2::ResourceHandle handle)
+            {
+                const ResourceManager::Slot *slot = ResourceManager::get_instance().find_slot(handle.index);
+                if (!slot || slot->generation.load(std::memory_order_acquire) != handle.generation) { return nullptr; }
+
+                ResourceType *resource = slot->pointer.load(std::memory_order_acquire);
+                return slot->generation.load(std::memory_order_acquire) == handle.generation ? resource : nullptr;
+            }
+
+            /// @brief Returns a shared pointer to the resource the handle points to.
+            /// @param handle Handle to the resource.
+            static std::shared_ptr<ResourceType> get_shared(sdl2::ResourceHandle handle)
+            {
+                ResourceManager &instance = ResourceManager::get_instance();
+                std::shared_lock<std::shared_mutex> slotLock{instance.m_slotLock};
+                if (!instance.is_current(handle)) { return nullptr; }
+
+                return instance.find_slot(handle.index)->resource;
+            }
+
+            /// @brief Releases the slot the handle points to. Every handle to it becomes stale.
+            /// @param handle Handle to release.
+            /// @note The resource itself lives on if it's still shared elsewhere.
+            static void release(sdl2::ResourceHandle handle)
+            {
+                ResourceManager &instance = ResourceManager::get_instance();
+
+                // The last reference is dropped outside of the lock since destroying a resource can take a while.
+                std::shared_ptr<ResourceType> released{};
                 {
-                    return findResource->second.lock();
+                    std::lock_guard<std::shared_mutex> slotGuard{instance.m_slotLock};
+                    released = instance.release_slot(handle);
                 }
-                else
+            }
+
+            /// @brief Sets the memory budget of the cache. While it's set, the manager holds the most recently requested
+            /// resources and evicts the least recently requested once their estimated size goes over the budget.
+            /// @param bytes Budget in bytes. 0 disables the cache and drops everything held by it.
+            /// @note Resources still in use elsewhere aren't freed by eviction, they just stop being held. Hits only stamp
+            /// their entry under the shard lock they already hold. Eviction measures the resources, which only the render
+            /// thread changes, so it only runs on the render thread: here, in collect() and in evict_pending(), which
+            /// Renderer::frame_begin calls. The cache can go over the budget until the next frame starts.
+            static void set_cache_budget(size_t bytes)
+            {
+                ResourceManager &instance = ResourceManager::get_instance();
+
+                instance.m_cacheBudget.store(bytes, std::memory_order_relaxed);
+                if (bytes == 0) { instance.drop_cache(); }
+                else { instance.evict_over_budget(); }
+            }
+
+            /// @brief Returns the estimated size of the resources held by the cache in bytes as of the last eviction pass.
+            static size_t get_cache_usage()
+            {
+                return ResourceManager::get_instance().m_cacheBytes.load(std::memory_order_relaxed);
+            }
+
+            /// @brief Releases every handle and drops everything held by the cache.
+            /// @note Slots and the cache hold their resources, so this needs to be called before whatever they depend on
+            /// is destroyed. Textures need the renderer, for example.
+            static void release_all()
+            {
+                ResourceManager &instance = ResourceManager::get_instance();
+                instance.drop_cache();
+
+                // Free slots are skipped. Releasing them again would put them on the free list twice.
+                std::lock_guard<std::shared_mutex> slotGuard{instance.m_slotLock};
+                for (uint32_t i = 0; i < instance.m_slotCount; i++)
                 {
-                    // Create the resource.
-                    auto resource = std::make_shared<ResourceType>(std::forward<Args>(args)...);
+                    const ResourceManager::Slot *slot = instance.find_slot(i);
+                    if (!slot->resource) { continue; }
 
-                    // Map it.
-                    resourceMap.try_emplace(std::string{name}, resource);
+                    instance.release_slot({.index = i, .generation = slot->generation.load(std::memory_order_relaxed)});
+                }
+            }
 
-                    // Return it.
-                    return resource;
+            /// @brief Purges every expired resource from the map now and evicts cached resources that grew over the budget.
+            /// Purging otherwise only happens as the map grows.
+            /// @note Calling this once per frame or between levels keeps the map from holding onto dead entries. Render
+            /// thread only.
+            static void collect()
+            {
+                ResourceManager &instance = ResourceManager::get_instance();
+                for (ResourceManager::Shard &shard : instance.m_shards)
+                {
+                    std::lock_guard<std::mutex> shardGuard{shard.lock};
+                    ResourceManager::purge_expired(shard);
                 }
-                return nullptr;
+
+                instance.evict_over_budget();
             }
 
-            /// @brief Templated function to allow derived resources for the managers.
-            /// @tparam Type Derived resource type.
-            /// @tparam ...Args Arguments to forward.
-            /// @param name Name of the resource.
-            template <typename Type, typename... Args>
-            static std::shared_ptr<ResourceType> create_load_resource(std::string_view name, Args &&...args)
+            /// @brief Evicts cached resources over the budget if anything was added to the cache since the last pass.
+            /// Render thread only. Renderer::frame_begin calls this every frame.
+            static void evict_pending()
             {
-                // Assert this so no surprises.
-                static_assert(std::derived_from<Type, ResourceType> == true, "ResourceManager: Type is not derived from base.");
+                ResourceManager &instance = ResourceManager::get_instance();
+                if (!instance.m_evictPending.exchange(false, std::memory_order_relaxed)) { return; }
 
-                // Repeat above, pretty much.
+                instance.evict_over_budget();
+            }
+
+            /// @brief Returns a snapshot of the entries, lookups and memory of the manager. Reads the size of every
+            /// resource, so it's render thread only.
+            static sdl2::ResourceStats get_stats()
+            {
                 ResourceManager &instance = ResourceManager::get_instance();
-                instance.purge_expired();
 
-                auto &resourceMap = instance.m_resourceMap;
+                sdl2::ResourceStats stats{};
+                for (ResourceManager::Shard &shard : instance.m_shards)
+                {
+                    std::lock_guard<std::mutex> shardGuard{shard.lock};
+                    stats.entryCount += shard.resourceMap.size();
+                    stats.hits += shard.hits;
+                    stats.misses += shard.misses;
+                    stats.creates += shard.creates;
+
+                    for (const auto &[name, entry] : shard.resourceMap)
+                    {
+                        std::shared_ptr<ResourceType> resource = entry.resource.lock();
+                        if (!resource)
+                        {
+                            if (!entry.loading) { ++stats.expiredCount; }
+                            continue;
+                        }
+
+                        const size_t bytes = resource->get_byte_size();
+                        ++stats.liveCount;
+                        stats.liveBytes += bytes;
+                        if (!entry.cached) { continue; }
+
+                        ++stats.cachedCount;
+                        stats.cachedBytes += bytes;
+                    }
+                }
+
+                std::shared_lock<std::shared_mutex> slotLock{instance.m_slotLock};
+                stats.handleCount = instance.m_slotMap.size();
+
+                return stats;
+            }
 
-                const auto &findResource = resourceMap.find(name);
-                if (findResource != resourceMap.end() && !findResource->second.expired())
+            /// @brief Returns the largest live resources, biggest first. Render thread only.
+            /// @param count Maximum number of resources to return.
+            static std::vector<sdl2::ResourceUsage> get_largest(size_t count)
+            {
+                ResourceManager &instance = ResourceManager::get_instance();
+
+                std::vector<sdl2::ResourceUsage> usage{};
+                for (ResourceManager::Shard &shard : instance.m_shards)
                 {
-                    return findResource->second.lock();
+                    std::lock_guard<std::mutex> shardGuard{shard.lock};
+                    for (const auto &[name, entry] : shard.resourceMap)
+                    {
+                        std::shared_ptr<ResourceType> resource = entry.resource.lock();
+                        if (!resource) { continue; }
+
+                        // The pointer locked here isn't counted.
+                        const long useCount = resource.use_count() - 1;
+                        usage.push_back({.name = name, .bytes = resource->get_byte_size(), .useCount = useCount});
+                    }
                 }
-                else
+
+                auto largerFirst = [](const sdl2::ResourceUsage &a, const sdl2::ResourceUsage &b) { return a.bytes > b.bytes; };
+                count            = std::min(count, usage.size());
+                std::partial_sort(usage.begin(), usage.begin() + count, usage.end(), largerFirst);
+                usage.resize(count);
+
+                return usage;
+            }
+
+            /// @brief Starts recording which resources are requested.
+            /// @param durationMs How long to record for in milliseconds.
+            static void start_recording(uint64_t durationMs)
+            {
+                ResourceManager &instance = ResourceManager::get_instance();
+                std::lock_guard<std::mutex> recordGuard{instance.m_recordLock};
+
+                instance.m_records.clear();
+                instance.m_recordUntil.store(SDL_GetTicks64() + durationMs, std::memory_order_relaxed);
+            }
+
+            /// @brief Returns whether or not requests are still being recorded.
+            static bool is_recording()
+            {
+                ResourceManager &instance = ResourceManager::get_instance();
+
+                // The clock is only read while a recording is running. Once it's over, the deadline is cleared so every
+                // request after only checks it.
+                uint64_t recordUntil = instance.m_recordUntil.load(std::memory_order_relaxed);
+                if (recordUntil == 0) { return false; }
+                else if (SDL_GetTicks64() < recordUntil) { return true; }
+
+                // Another recording could have been started in the meantime. That one is left alone.
+                instance.m_recordUntil.compare_exchange_strong(recordUntil, 0, std::memory_order_relaxed);
+                return false;
+            }
+
+            /// @brief Returns a copy of the resources requested while recording in the order they were first requested.
+            static std::vector<sdl2::ResourceRecord> get_records()
+            {
+                ResourceManager &instance = ResourceManager::get_instance();
+                std::lock_guard<std::mutex> recordGuard{instance.m_recordLock};
+
+                return instance.m_records;
+            }
+
+            /// @brief Records a request if a recording is running. Loaders that create resources under a name and fill
+            /// them in later use this to record the path.
+            /// @param name Name of the resource.
+            /// @param path Path the resource is loaded from. Can be empty.
+            static void record_request(std::string_view name, std::string_view path)
+            {
+                if (!ResourceManager::is_recording()) { return; }
+
+                ResourceManager &instance = ResourceManager::get_instance();
+                std::lock_guard<std::mutex> recordGuard{instance.m_recordLock};
+
+                auto matchName  = [=](const sdl2::ResourceRecord &record) { return record.name == name; };
+                auto findRecord = std::find_if(instance.m_records.begin(), instance.m_records.end(), matchName);
+                if (findRecord == instance.m_records.end())
                 {
-                    const auto resource = std::make_shared<Type>(std::forward<Args>(args)...);
-                    resourceMap.try_emplace(std::string{name}, resource);
-                    return resource;
+                    instance.m_records.push_back({.name = std::string{name}, .path = std::string{path}});
                 }
-                return nullptr;
+                else if (findRecord->path.empty()) { findRecord->path = path; }
             }
 
         private:
+            // clang-format off
+            /// @brief Slot a handle points to. The pointer and generation are atomic so get() can read them without the
+            /// slot lock.
+            struct Slot
+            {
+                std::shared_ptr<ResourceType> resource{};
+                std::atomic<ResourceType *> pointer{};
+                std::atomic<uint32_t> generation{1};
+                sdl2::ResourceId id{};
+            };
+
+            /// @brief Entry in the resource map. The cache holds a resource through its entry.
+            struct MapEntry
+            {
+                std::weak_ptr<ResourceType> resource{};
+                std::shared_ptr<ResourceType> cached{};
+                uint64_t lastUse{};
+                bool loading{};
+            };
+
+            /// @brief Cached resource considered for eviction.
+            struct EvictionCandidate
+            {
+                size_t shard{};
+                std::string name{};
+                uint64_t lastUse{};
+                size_t bytes{};
+            };
+            // clang-format on
+
+            /// @brief Number of slots allocated at a time.
+            static constexpr uint32_t SLOT_CHUNK_SIZE = 256;
+
+            /// @brief Maximum number of slot chunks. Chunks are never moved or freed, so their pointers can be read without
+            /// a lock.
+            static constexpr uint32_t MAX_SLOT_CHUNKS = 256;
+
+            /// @brief Fixed block of slots.
+            using SlotChunk = std::array<ResourceManager::Slot, SLOT_CHUNK_SIZE>;
+
+            /// @brief Smallest size a shard's map needs to grow to before it's purged.
+            static constexpr size_t MIN_PURGE_THRESHOLD = 16;
+
+            /// @brief Number of shards names are spread across. Lookups only contend when their names land in the same one.
+            static constexpr size_t SHARD_COUNT = 16;
+
             // clang-format off
             struct StringViewHash
             {
@@ -108,10 +472,62 @@ namespace sdl2
                 using is_transparent = void;
                 bool operator() (std::string_view viewA, std::string_view viewB) const noexcept { return viewA == viewB; }
             };
+
+            /// @brief Part of the resource map with its own lock. Aligned so neighbouring locks don't share a cache line.
+            /// Lookup counts are kept per shard so they're only written under a lock that's already held.
+            struct alignas(64) Shard
+            {
+                std::mutex lock{};
+                std::condition_variable loadCondition{};
+                std::unordered_map<std::string, MapEntry, StringViewHash, StringViewEquals> resourceMap{};
+                size_t purgeThreshold{MIN_PURGE_THRESHOLD};
+                uint64_t hits{};
+                uint64_t misses{};
+                uint64_t creates{};
+            };
             // clang-format on
 
-            /// @brief Map with weak pointers to resources.
-            std::unordered_map<std::string, std::weak_ptr<ResourceType>, StringViewHash, StringViewEquals> m_resourceMap{};
+            /// @brief Shards of the map with weak pointers to resources.
+            std::array<ResourceManager::Shard, SHARD_COUNT> m_shards{};
+
+            /// @brief Guards the slots' resources, the free list and the slot map. get() doesn't need it.
+            std::shared_mutex m_slotLock{};
+
+            /// @brief Chunks of slots handles index into. Published with release so get() sees them fully constructed.
+            std::array<std::atomic<ResourceManager::SlotChunk *>, MAX_SLOT_CHUNKS> m_slotChunks{};
+
+            /// @brief Owns the chunks.
+            std::vector<std::unique_ptr<ResourceManager::SlotChunk>> m_slotChunkStorage{};
+
+            /// @brief Number of slots handed out so far.
+            uint32_t m_slotCount{};
+
+            /// @brief Slots released and free to reuse.
+            std::vector<uint32_t> m_freeSlots{};
+
+            /// @brief Maps resource IDs to their slots.
+            std::unordered_map<sdl2::ResourceId, uint32_t> m_slotMap{};
+
+            /// @brief Only one eviction pass runs at a time.
+            std::mutex m_evictLock{};
+
+            /// @brief Cache budget in bytes. 0 means the cache is disabled.
+            std::atomic<size_t> m_cacheBudget{};
+
+            /// @brief Estimated size of everything in the cache as of the last eviction pass.
+            std::atomic<size_t> m_cacheBytes{};
+
+            /// @brief Whether or not something was cached since the last eviction pass.
+            std::atomic<bool> m_evictPending{};
+
+            /// @brief Guards the records.
+            std::mutex m_recordLock{};
+
+            /// @brief Requests are recorded until SDL_GetTicks64 reaches this. 0 when nothing is being recorded.
+            std::atomic<uint64_t> m_recordUntil{};
+
+            /// @brief Resources requested while recording.
+            std::vector<sdl2::ResourceRecord> m_records{};
 
             /// @brief Private constructor.
             ResourceManager() = default;
@@ -123,24 +539,323 @@ namespace sdl2
                 return instance;
             }
 
-            /// @brief Purges expired resources from the map.
-            void purge_expired()
+            /// @brief Returns the first argument passed if it's a path. Empty otherwise.
+            template <typename... Args>
+            static std::string_view get_path(const Args &...args)
+            {
+                if constexpr (sizeof...(Args) == 0) { return {}; }
+                else
+                {
+                    const auto &first = std::get<0>(std::tie(args...));
+                    if constexpr (std::convertible_to<decltype(first), std::string_view>) { return first; }
+                    else { return {}; }
+                }
+            }
+
+            /// @brief Returns the resource mapped to the name passed, creating it if it doesn't exist.
+            /// @tparam Type Type to construct.
+            /// @param name Name of the resource.
+            /// @param ...args Arguments to forward to the constructor.
+            template <typename Type, typename... Args>
+            static std::shared_ptr<ResourceType> find_or_create(std::string_view name, Args &&...args)
             {
-                for (auto iter = m_resourceMap.begin(); iter != m_resourceMap.end();)
+                // Grab the instance.
+                ResourceManager &instance = ResourceManager::get_instance();
+
+                // Record the request if a recording is running.
+                ResourceManager::record_request(name, ResourceManager::get_path(args...));
+
+                // Only the shard the name belongs to is locked.
+                ResourceManager::Shard &shard = instance.m_shards[StringViewHash{}(name) % SHARD_COUNT];
+                std::unique_lock<std::mutex> shardLock{shard.lock};
+
+                // Wait for another thread creating the same resource instead of creating it twice.
+                bool waited       = false;
+                auto findResource = shard.resourceMap.find(name);
+                while (findResource != shard.resourceMap.end() && findResource->second.loading)
                 {
-                    // Weak ptr.
-                    const auto &weakPtr = iter->second;
+                    waited = true;
+                    shard.loadCondition.wait(shardLock);
+                    findResource = shard.resourceMap.find(name);
+                }
 
-                    // If it's expired, purge it.
-                    if (weakPtr.expired())
+                // Search for resource.
+                if (findResource != shard.resourceMap.end())
+                {
+                    std::shared_ptr<ResourceType> resource = findResource->second.resource.lock();
+                    if (resource)
                     {
-                        iter = m_resourceMap.erase(iter);
+                        ++(waited ? shard.misses : shard.hits);
+                        // Plain hits only stamp their entry. Eviction only needs to run when the cache grew.
+                        if (instance.touch(findResource->second, resource)) { instance.request_eviction(); }
+                        return resource;
+                    }
+                }
+
+                // Claim the name so other threads wait for this one.
+                ++shard.misses;
+                ResourceManager::claim_name(shard, findResource, name);
+                shardLock.unlock();
+
+                // Create the resource without holding the lock so the rest of the shard isn't blocked.
+                std::shared_ptr<ResourceType> resource = std::make_shared<Type>(std::forward<Args>(args)...);
+                SDL2_COUNT_RESOURCE(Created);
+
+                // Map it and wake anything waiting on it.
+                shardLock.lock();
+                ++shard.creates;
+                ResourceManager::MapEntry *entry = ResourceManager::map_resource(shard, name, resource);
+                if (entry && instance.touch(*entry, resource)) { instance.request_eviction(); }
+                shardLock.unlock();
+                shard.loadCondition.notify_all();
+
+                // Return it.
+                return resource;
+            }
+
+            /// @brief Returns whether or not the handle points to a live slot. The slot lock must be held.
+            /// @param handle Handle to check.
+            /// @note Free slots keep the generation they were released with, so a handle built from one still matches
+            /// it. Those are told apart by not holding a resource.
+            bool is_current(sdl2::ResourceHandle handle) const noexcept
+            {
+                const ResourceManager::Slot *slot = ResourceManager::find_slot(handle.index);
+                return slot && slot->generation.load(std::memory_order_relaxed) == handle.generation && slot->resource;
+            }
+
+            /// @brief Returns the slot at the index passed. Doesn't need the slot lock.
+            /// @param index Index of the slot.
+            /// @return Slot. nullptr if its chunk hasn't been allocated.
+            const ResourceManager::Slot *find_slot(uint32_t index) const noexcept
+            {
+                const uint32_t chunk = index / SLOT_CHUNK_SIZE;
+                if (chunk >= MAX_SLOT_CHUNKS) { return nullptr; }
+
+                const ResourceManager::SlotChunk *slotChunk = m_slotChunks[chunk].load(std::memory_order_acquire);
+                return slotChunk ? &(*slotChunk)[index % SLOT_CHUNK_SIZE] : nullptr;
+            }
+
+            /// @brief Returns the slot at the index passed for writing. The slot lock must be held exclusively.
+            /// @param index Index of the slot. Its chunk must exist.
+            ResourceManager::Slot &get_slot(uint32_t index) noexcept
+            {
+                return (*m_slotChunks[index / SLOT_CHUNK_SIZE].load(std::memory_order_relaxed))[index % SLOT_CHUNK_SIZE];
+            }
+
+            /// @brief Puts the resource passed in a free slot and returns the handle to it.
+            /// @param id ID of the resource.
+            /// @param resource Resource to hold.
+            sdl2::ResourceHandle assign_slot(sdl2::ResourceId id, std::shared_ptr<ResourceType> resource)
+            {
+                std::lock_guard<std::shared_mutex> slotGuard{m_slotLock};
+
+                // Another thread might have assigned it first.
+                const auto findSlot = m_slotMap.find(id);
+                if (findSlot != m_slotMap.end())
+                {
+                    const ResourceManager::Slot &slot = ResourceManager::get_slot(findSlot->second);
+                    return {.index = findSlot->second, .generation = slot.generation.load(std::memory_order_relaxed)};
+                }
+
+                uint32_t index = m_slotCount;
+                if (!m_freeSlots.empty())
+                {
+                    index = m_freeSlots.back();
+                    m_freeSlots.pop_back();
+                }
+                else
+                {
+                    // Chunks are published once they're constructed and never move after.
+                    const uint32_t chunk = index / SLOT_CHUNK_SIZE;
+                    if (chunk >= MAX_SLOT_CHUNKS) { return {}; }
+                    else if (index % SLOT_CHUNK_SIZE == 0)
+                    {
+                        m_slotChunkStorage.push_back(std::make_unique<ResourceManager::SlotChunk>());
+                        m_slotChunks[chunk].store(m_slotChunkStorage.back().get(), std::memory_order_release);
+                    }
+                    ++m_slotCount;
+                }
+
+                ResourceManager::Slot &slot = ResourceManager::get_slot(index);
+                slot.pointer.store(resource.get(), std::memory_order_release);
+                slot.resource = std::move(resource);
+                slot.id       = id;
+                m_slotMap.try_emplace(id, index);
+
+                return {.index = index, .generation = slot.generation.load(std::memory_order_relaxed)};
+            }
+
+            /// @brief Releases the slot the handle points to. The slot lock must be held exclusively.
+            /// @param handle Handle to release.
+            /// @return The resource the slot held, so it can be dropped after the lock is released.
+            std::shared_ptr<ResourceType> release_slot(sdl2::ResourceHandle handle)
+            {
+                if (!ResourceManager::is_current(handle)) { return nullptr; }
+
+                ResourceManager::Slot &slot = ResourceManager::get_slot(handle.index);
+                m_slotMap.erase(slot.id);
+
+                // The generation changes before the pointer is cleared, so get() never pairs the old generation with a
+                // pointer from the slot's next use. Skip 0 when wrapping so it's never valid.
+                const uint32_t generation = handle.generation + 1;
+                slot.generation.store(generation == 0 ? 1 : generation, std::memory_order_release);
+                slot.pointer.store(nullptr, std::memory_order_release);
+                m_freeSlots.push_back(handle.index);
+
+                return std::move(slot.resource);
+            }
+
+            /// @brief Marks the name as being loaded. Expired entries with the same name are reused. The shard lock must be
+            /// held.
+            /// @param shard Shard the name belongs to.
+            /// @param findResource Result of searching the shard for the name.
+            /// @param name Name of the resource.
+            template <typename Iterator>
+            static void claim_name(ResourceManager::Shard &shard, Iterator findResource, std::string_view name)
+            {
+                if (findResource != shard.resourceMap.end())
+                {
+                    findResource->second.loading = true;
+                    return;
+                }
+
+                shard.resourceMap.try_emplace(std::string{name}, ResourceManager::MapEntry{.loading = true});
+
+                // Purging only when the map doubles in size keeps the cost per creation constant.
+                if (shard.resourceMap.size() >= shard.purgeThreshold) { ResourceManager::purge_expired(shard); }
+            }
+
+            /// @brief Maps the resource passed to the name claimed earlier. The shard lock must be held.
+            /// @param shard Shard the name belongs to.
+            /// @param name Name of the resource.
+            /// @param resource Resource to map.
+            /// @return Entry the resource was mapped to. nullptr if the name wasn't claimed.
+            static ResourceManager::MapEntry *map_resource(ResourceManager::Shard &shard,
+                                                           std::string_view name,
+                                                           const std::shared_ptr<ResourceType> &resource)
+            {
+                // The iterator from the claim might have been invalidated by other insertions.
+                const auto findResource = shard.resourceMap.find(name);
+                if (findResource == shard.resourceMap.end()) { return nullptr; }
+
+                ResourceManager::MapEntry &entry = findResource->second;
+                entry.resource                   = resource;
+                entry.loading                    = false;
+                return &entry;
+            }
+
+            /// @brief Stamps the entry as just used and caches its resource if it isn't already. The shard lock must be held.
+            /// @param entry Entry of the resource.
+            /// @param resource Resource requested.
+            /// @return True if the resource was added to the cache and an eviction pass is needed.
+            bool touch(ResourceManager::MapEntry &entry, const std::shared_ptr<ResourceType> &resource) const noexcept
+            {
+                if (m_cacheBudget.load(std::memory_order_relaxed) == 0) { return false; }
+
+                // The clock is only read, so hits on different shards never write to the same memory.
+                entry.lastUse = std::chrono::steady_clock::now().time_since_epoch().count();
+                if (entry.cached) { return false; }
+
+                entry.cached = resource;
+                return true;
+            }
+
+            /// @brief Flags an eviction pass for the next evict_pending(). Requests can come from any thread, but the
+            /// sizes eviction reads are only safe to read on the render thread.
+            void request_eviction() noexcept { m_evictPending.store(true, std::memory_order_relaxed); }
+
+            /// @brief Evicts the least recently requested resources until the cache fits the budget. The most recent one
+            /// is always kept. Render thread only.
+            void evict_over_budget()
+            {
+                const size_t budget = m_cacheBudget.load(std::memory_order_relaxed);
+                if (budget == 0) { return; }
+
+                std::lock_guard<std::mutex> evictGuard{m_evictLock};
+
+                // Sizes are measured every pass since things like textures can load in the background.
+                std::vector<ResourceManager::EvictionCandidate> candidates{};
+                size_t cachedBytes{};
+                for (size_t i = 0; i < SHARD_COUNT; i++)
+                {
+                    ResourceManager::Shard &shard = m_shards[i];
+                    std::lock_guard<std::mutex> shardGuard{shard.lock};
+                    for (const auto &[name, entry] : shard.resourceMap)
+                    {
+                        if (!entry.cached) { continue; }
+
+                        const size_t bytes = entry.cached->get_byte_size();
+                        cachedBytes += bytes;
+                        candidates.push_back({.shard = i, .name = name, .lastUse = entry.lastUse, .bytes = bytes});
+                    }
+                }
+
+                // Dropped resources are destroyed after the shard locks are released.
+                std::vector<std::shared_ptr<ResourceType>> evicted{};
+                if (cachedBytes > budget)
+                {
+                    auto olderFirst = [](const auto &a, const auto &b) { return a.lastUse < b.lastUse; };
+                    std::sort(candidates.begin(), candidates.end(), olderFirst);
+
+                    for (size_t i = 0; i + 1 < candidates.size() && cachedBytes > budget; i++)
+                    {
+                        const ResourceManager::EvictionCandidate &candidate = candidates[i];
+                        ResourceManager::Shard &shard                       = m_shards[candidate.shard];
+                        std::lock_guard<std::mutex> shardGuard{shard.lock};
+
+                        // Entries requested since they were measured are left alone.
+                        const auto findEntry = shard.resourceMap.find(candidate.name);
+                        if (findEntry == shard.resourceMap.end()) { continue; }
+                        else if (findEntry->second.lastUse != candidate.lastUse) { continue; }
+
+                        evicted.push_back(std::move(findEntry->second.cached));
+                        cachedBytes -= candidate.bytes;
+                    }
+                }
+
+                m_cacheBytes.store(cachedBytes, std::memory_order_relaxed);
+            }
+
+            /// @brief Drops everything held by the cache.
+            void drop_cache()
+            {
+                std::lock_guard<std::mutex> evictGuard{m_evictLock};
+
+                std::vector<std::shared_ptr<ResourceType>> dropped{};
+                for (ResourceManager::Shard &shard : m_shards)
+                {
+                    std::lock_guard<std::mutex> shardGuard{shard.lock};
+                    for (auto &[name, entry] : shard.resourceMap)
+                    {
+                        if (entry.cached) { dropped.push_back(std::move(entry.cached)); }
+                    }
+                }
+
+                m_cacheBytes.store(0, std::memory_order_relaxed);
+            }
+
+            /// @brief Purges expired resources from the shard. The shard lock must be held.
+            /// @param shard Shard to purge.
+            static void purge_expired(ResourceManager::Shard &shard)
+            {
+                for (auto iter = shard.resourceMap.begin(); iter != shard.resourceMap.end();)
+                {
+                    // Entry.
+                    const ResourceManager::MapEntry &entry = iter->second;
+
+                    // If it's expired and nothing is loading it, purge it.
+                    if (entry.resource.expired() && !entry.loading)
+                    {
+                        SDL2_COUNT_RESOURCE(Purged);
+                        iter = shard.resourceMap.erase(iter);
                         continue;
                     }
 
                     // Increment iterator.
                     ++iter;
                 }
+
+                shard.purgeThreshold = std::max(MIN_PURGE_THRESHOLD, shard.resourceMap.size() * 2);
             }
     };
 
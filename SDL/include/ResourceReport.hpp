@@ -0,0 +1,23 @@
+#pragma once
+#include "ResourceManager.hpp"
+
+#include <cstddef>
+#include <string_view>
+
+namespace sdl2
+{
+    /// @brief Debug reports of what the resource managers hold.
+    /** @note
+     *  Sizes are the estimates resources report through get_byte_size. Textures are only sprites and other textures
+     *  loaded through the TextureManager. Faces and glyph pages are shared between fonts, so they're
+     *  reported once in their own section instead of with each font.
+     */
+    namespace resource_report
+    {
+        /// @brief Writes the stats of the texture, font and sound managers and their largest resources to a file.
+        /// @param filePath Path to write to.
+        /// @param largestCount Number of the largest resources to list for each manager.
+        /// @return True on success. False on failure.
+        bool write(std::string_view filePath, size_t largestCount = 10);
+    }
+}
\ No newline at end of file
@@ -1,9 +1,58 @@
 #pragma once
 #include "Renderer.hpp"
-#include "ResourceManager.hpp"
+#include "Texture.hpp"
+
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <memory>
 
 namespace sdl2
 {
-    class ScopedRender()
+    /// @brief Renders to a target for as long as the instance is in scope.
+    /** @note
+     *  The target is pushed onto the renderer's target stack on construction and popped on destruction, which restores
+     *  the previous target, clip rectangle and logical size. Copy the target out before the scope ends to keep it.
+     */
+    class ScopedRender final
+    {
+        public:
+            /// @brief Begins rendering to the target passed.
+            /// @param renderer Renderer to use.
+            /// @param target Target to render to.
+            ScopedRender(sdl2::Renderer &renderer, std::shared_ptr<sdl2::Texture> target);
+
+            /// @brief Begins rendering to a target from the renderer's pool. The target is cleared to transparent.
+            /// @note What's drawn onto the target ends up premultiplied, so the target is drawn with the premultiplied
+            /// blend mode. Set another mode on it if that isn't wanted.
+            /// @param renderer Renderer to use.
+            /// @param width Width of the target.
+            /// @param height Height of the target.
+            /// @param format Pixel format of the target.
+            ScopedRender(sdl2::Renderer &renderer, int width, int height, uint32_t format = SDL_PIXELFORMAT_ARGB8888);
+
+            /// @brief Pops the target.
+            ~ScopedRender();
+
+            // No copying or moving. Only one instance should pop.
+            ScopedRender(const ScopedRender &) = delete;
+            ScopedRender(ScopedRender &&)      = delete;
+            ScopedRender &operator=(const ScopedRender &) = delete;
+            ScopedRender &operator=(ScopedRender &&)      = delete;
+
+            /// @brief Returns whether or not the target was pushed successfully.
+            bool is_active() const noexcept;
+
+            /// @brief Returns the target being rendered to. nullptr if one couldn't be acquired.
+            const std::shared_ptr<sdl2::Texture> &get_target() const noexcept;
+
+        private:
+            /// @brief Renderer the target was pushed to.
+            sdl2::Renderer &m_renderer;
+
+            /// @brief Target being rendered to.
+            std::shared_ptr<sdl2::Texture> m_target{};
 
+            /// @brief Whether or not the target was pushed.
+            bool m_isActive{};
+    };
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 #include <SDL2/SDL.h>
+#include <cstddef>
 #include <memory>
+#include <span>
 #include <string_view>
 
 namespace sdl2
@@ -15,6 +17,13 @@ namespace sdl2
             /// @brief Loads a new wav sound from the path passed.
             Sound(std::string_view path);
 
+            /// @brief Loads a wav sound from the data passed.
+            /// @param data View of wav data, such as one from an AssetPack.
+            Sound(std::span<const std::byte> data);
+
+            /// @brief Returns the size of the sound buffer in bytes.
+            size_t get_byte_size() const noexcept;
+
             /// @brief Plays the sound.
             void play() const;
 
@@ -0,0 +1,53 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <vector>
+
+namespace sdl2
+{
+    /// @brief Collects textured quads and submits them with SDL_RenderGeometry.
+    /** @note
+     *  Quads are only merged while they share a texture. Draw order is preserved, so interleaving textures still costs a
+     *  draw call per switch. Packing sprites into a TextureAtlas keeps runs long.
+     */
+    class SpriteBatch final
+    {
+        public:
+            /// @brief Default constructor.
+            SpriteBatch() = default;
+
+            /// @brief Appends a quad to the batch.
+            /// @param texture Texture the quad samples from. Must match the texture already queued, if any.
+            /// @param textureWidth Width of the texture. Used to normalize the source rectangle.
+            /// @param textureHeight Height of the texture.
+            /// @param source Source rectangle on the texture.
+            /// @param destination Destination rectangle.
+            /// @param color Color and alpha modulation of the quad.
+            void add_quad(SDL_Texture *texture,
+                          int textureWidth,
+                          int textureHeight,
+                          const SDL_Rect &source,
+                          const SDL_Rect &destination,
+                          SDL_Color color);
+
+            /// @brief Submits everything queued in a single SDL_RenderGeometry call and clears the batch.
+            /// @param renderer Renderer to submit to.
+            /// @return True on success or if nothing was queued. False on failure.
+            bool flush(SDL_Renderer *renderer);
+
+            /// @brief Returns the texture the queued quads use. nullptr if the batch is empty.
+            SDL_Texture *get_texture() const noexcept;
+
+            /// @brief Returns whether or not the batch is empty.
+            bool is_empty() const noexcept;
+
+        private:
+            /// @brief Texture currently being batched.
+            SDL_Texture *m_texture{};
+
+            /// @brief Vertices of the queued quads.
+            std::vector<SDL_Vertex> m_vertices{};
+
+            /// @brief Indices of the queued quads. Two triangles per quad.
+            std::vector<int> m_indices{};
+    };
+}
\ No newline at end of file
@@ -1,4 +1,6 @@
 #pragma once
+#include "Qoi.hpp"
+
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_image.h>
 #include <memory>
@@ -36,9 +38,11 @@ namespace sdl2
         }
 
         /// @brief Returns a surface created from an external file.
-        /// @param filePath Path of the image to load.
+        /// @param filePath Path of the image to load. Files ending in .qoi are decoded by the built in QOI decoder.
         inline Surface from_file(std::string_view filePath)
         {
+            if (qoi::has_extension(filePath)) { return Surface(qoi::load(filePath), SDL_FreeSurface); }
+
             // Just fall bad to SDL_image for this. Screw using libpng and libjpeg directly...
             return Surface(IMG_Load(filePath.data()), SDL_FreeSurface);
         }
@@ -49,8 +53,14 @@ namespace sdl2
         template <typename Type>
         inline Surface from_memory(std::span<const Type> data)
         {
+            // QOI is recognized by its magic.
+            if (qoi::is_qoi(data.data(), data.size_bytes()))
+            {
+                return Surface(qoi::decode(data.data(), data.size_bytes()), SDL_FreeSurface);
+            }
+
             // SDL RWOps.
-            SDL_RWops *rwOps = SDL_RWFromConstMem(data.data(), data.size());
+            SDL_RWops *rwOps = SDL_RWFromConstMem(data.data(), data.size_bytes());
             return Surface(IMG_Load_RW(rwOps, 1), SDL_FreeSurface);
         }
     }
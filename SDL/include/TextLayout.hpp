@@ -0,0 +1,141 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace sdl2
+{
+    /// @brief Forward declaration so Font can fill and replay layouts.
+    class Font;
+
+    /// @brief Precomputed glyph positions, line breaks and color changes for a block of text.
+    /** @note
+     *  Layouts are created by Font::create_layout and replayed with Font::render_layout. They reference the glyph atlas of
+     *  the font that created them and can only be rendered with that font.
+     */
+    class TextLayout final
+    {
+        public:
+            /// @brief Default constructor.
+            TextLayout() = default;
+
+            /// @brief Returns the width of the widest line.
+            int get_width() const noexcept;
+
+            /// @brief Returns the total height of the lines.
+            int get_height() const noexcept;
+
+            /// @brief Returns the number of glyphs that are drawn.
+            size_t get_glyph_count() const noexcept;
+
+            /// @brief Allows font to build and replay layouts.
+            friend class Font;
+
+        private:
+            // clang-format off
+            /// @brief Glyph placed relative to the origin of the layout.
+            struct Glyph
+            {
+                int x{};
+                int y{};
+                int16_t page{};
+                SDL_Rect source{};
+            };
+
+            /// @brief Color changing codepoint and the first glyph it applies to.
+            struct ColorSpan
+            {
+                size_t firstGlyph{};
+                uint32_t codepoint{};
+            };
+            // clang-format on
+
+            /// @brief Glyphs in drawing order.
+            std::vector<TextLayout::Glyph> m_glyphs{};
+
+            /// @brief Color changes in the order they occur.
+            std::vector<TextLayout::ColorSpan> m_colorSpans{};
+
+            /// @brief Width of the widest line.
+            int m_width{};
+
+            /// @brief Total height.
+            int m_height{};
+    };
+
+    /// @brief Least recently used cache of text layouts keyed by text and wrap width.
+    class TextLayoutCache final
+    {
+        public:
+            /// @brief Default number of layouts kept.
+            static constexpr size_t DEFAULT_CAPACITY = 32;
+
+            /// @brief Creates a new cache.
+            /// @param capacity Maximum number of layouts kept.
+            TextLayoutCache(size_t capacity = DEFAULT_CAPACITY);
+
+            /// @brief Searches for a layout and marks it as most recently used.
+            /// @param text Text of the layout.
+            /// @param maxWidth Wrap width of the layout.
+            /// @return Pointer to the layout. nullptr if it isn't cached.
+            const sdl2::TextLayout *find(std::string_view text, int maxWidth);
+
+            /// @brief Inserts a layout, evicting the least recently used one if the cache is full.
+            /// @param text Text of the layout.
+            /// @param maxWidth Wrap width of the layout.
+            /// @param layout Layout to cache.
+            /// @return Reference to the cached layout.
+            const sdl2::TextLayout &insert(std::string_view text, int maxWidth, sdl2::TextLayout layout);
+
+            /// @brief Sets the maximum number of layouts kept.
+            /// @param capacity Capacity to set. At least one layout is always kept.
+            void set_capacity(size_t capacity);
+
+            /// @brief Removes every layout from the cache.
+            void clear();
+
+        private:
+            // clang-format off
+            /// @brief Cache entry. The list owns the text that the map keys point to.
+            struct Entry
+            {
+                std::string text{};
+                int maxWidth{};
+                sdl2::TextLayout layout{};
+            };
+
+            /// @brief Map key. The text is a view into the entry it points to.
+            struct Key
+            {
+                std::string_view text{};
+                int maxWidth{};
+
+                bool operator==(const Key &key) const noexcept = default;
+            };
+
+            struct KeyHash
+            {
+                size_t operator() (const Key &key) const noexcept
+                {
+                    return std::hash<std::string_view>{}(key.text) ^ (std::hash<int>{}(key.maxWidth) << 1);
+                }
+            };
+            // clang-format on
+
+            /// @brief Maximum number of entries.
+            size_t m_capacity{};
+
+            /// @brief Entries ordered from most to least recently used.
+            std::list<TextLayoutCache::Entry> m_entries{};
+
+            /// @brief Map of keys to entries.
+            std::unordered_map<TextLayoutCache::Key, std::list<TextLayoutCache::Entry>::iterator, KeyHash> m_entryMap{};
+
+            /// @brief Evicts entries until the cache is within capacity.
+            void trim();
+    };
+}
\ No newline at end of file
@@ -4,6 +4,8 @@
 #include "Surface.hpp"
 
 #include <SDL2/SDL.h>
+#include <cstddef>
+#include <span>
 #include <string_view>
 
 namespace sdl2
@@ -34,11 +36,16 @@ namespace sdl2
             /// @param dataSize Size of the image data.
             Texture(const void *data, size_t dataSize);
 
+            /// @brief Loads an image from the data passed and creates a texture from it.
+            /// @param data View of image data, such as one from an AssetPack.
+            Texture(std::span<const std::byte> data);
+
             /// @brief Creates a blank texture using the arguments passed.
             /// @param width Width of the texture.
             /// @param height Height of the texture.
             /// @param textureAccess Texture access.
-            Texture(int width, int height, SDL_TextureAccess textureAccess);
+            /// @param format Pixel format of the texture.
+            Texture(int width, int height, SDL_TextureAccess textureAccess, uint32_t format = SDL_PIXELFORMAT_ARGB8888);
 
             /// @brief Destructs the texture.
             ~Texture();
@@ -49,6 +56,9 @@ namespace sdl2
             /// @brief Returns the height of the texture.
             int get_height() const noexcept;
 
+            /// @brief Returns the estimated memory used by the texture in bytes.
+            size_t get_byte_size() const noexcept;
+
             /// @brief Sets the blending mode of the texture.
             /// @param mode Mode to set.
             bool set_blend_mode(SDL_BlendMode mode = SDL_BLENDMODE_BLEND);
@@ -57,6 +67,17 @@ namespace sdl2
             /// @param color Color to set the mod to.
             bool set_color_mod(SDL_Color color);
 
+            /// @brief Sets the alpha mod of the texture.
+            /// @param alpha Alpha to set the mod to.
+            bool set_alpha_mod(uint8_t alpha);
+
+            /// @brief Uploads the pixels of the surface passed to a region of the texture.
+            /// @param x X coordinate of the region.
+            /// @param y Y coordinate of the region.
+            /// @param surface Surface containing the pixels. Converted to the texture's format if needed.
+            /// @note The texture must be created with SDL_TEXTUREACCESS_STATIC or SDL_TEXTUREACCESS_STREAMING.
+            bool update_region(int x, int y, sdl2::Surface &surface);
+
             /// @brief Renders the texture at the coordinates passed.
             /// @param x X coordinate.
             /// @param y Y coordinate.
@@ -98,11 +119,21 @@ namespace sdl2
 
             /// @brief Initializes the Texture class.
             /// @param renderer Reference to renderer that textures shall belong to.
-            static void initialize(const sdl2::Renderer &renderer);
+            static void initialize(sdl2::Renderer &renderer);
+
+            /// @brief Returns the renderer textures belong to. nullptr before initialize() is called.
+            static sdl2::Renderer *get_renderer() noexcept;
+
+            /// @brief Returns the blend mode for drawing premultiplied content, such as anything rendered onto a cleared,
+            /// transparent target.
+            static SDL_BlendMode get_premultiplied_blend_mode() noexcept;
 
             /// @brief Allows the renderer to set targets easier.
             friend class Renderer;
 
+            /// @brief Allows the loader to fill in textures once they're decoded.
+            friend class TextureLoader;
+
         private:
             /// @brief Underlying SDL_Texture.
             SDL_Texture *m_texture{};
@@ -113,7 +144,22 @@ namespace sdl2
             /// @brief Height of the texture.
             int m_height{};
 
-            /// @brief Shared pointer to the renderer once it's passed.
-            static inline SDL_Renderer *sm_renderer{};
+            /// @brief Color and alpha mod of the texture. Batched quads carry this as their vertex color.
+            SDL_Color m_colorMod{0xFF, 0xFF, 0xFF, 0xFF};
+
+            /// @brief Blend mode of the texture.
+            SDL_BlendMode m_blendMode{SDL_BLENDMODE_INVALID};
+
+            /// @brief Pointer to the renderer once it's passed.
+            static inline sdl2::Renderer *sm_renderer{};
+
+            /// @brief Creates the underlying texture from the surface passed.
+            /// @param surface Surface to create the texture from.
+            /// @return True on success. False on failure or if the texture was already created.
+            bool load_surface(sdl2::Surface &surface);
+
+            /// @brief Counts a state change that was skipped because the value didn't change.
+            /// @return Always true so setters can return it directly.
+            static bool skip_state_change() noexcept;
     };
 }
\ No newline at end of file
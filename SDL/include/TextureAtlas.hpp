@@ -0,0 +1,195 @@
+#pragma once
+#include "CoreComponent.hpp"
+#include "Surface.hpp"
+#include "Texture.hpp"
+
+#include <SDL2/SDL.h>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace sdl2
+{
+    /// @brief Lightweight handle to a region of a texture atlas page.
+    class SubTexture final
+    {
+        public:
+            /// @brief Default constructor.
+            SubTexture() = default;
+
+            /// @brief Creates a new sub texture.
+            /// @param page Atlas page the region belongs to.
+            /// @param source Region of the page.
+            SubTexture(std::shared_ptr<sdl2::Texture> page, SDL_Rect source);
+
+            /// @brief Returns whether or not the sub texture points to a valid region.
+            bool is_initialized() const noexcept;
+
+            /// @brief Returns the width of the region.
+            int get_width() const noexcept;
+
+            /// @brief Returns the height of the region.
+            int get_height() const noexcept;
+
+            /// @brief Returns the source rectangle of the region on the page.
+            const SDL_Rect &get_source() const noexcept;
+
+            /// @brief Returns the page texture the region belongs to.
+            const std::shared_ptr<sdl2::Texture> &get_page() const noexcept;
+
+            /// @brief Sets the color mod of the page. This affects every region on the page.
+            /// @param color Color to set the mod to.
+            bool set_color_mod(SDL_Color color);
+
+            /// @brief Renders the region at the coordinates passed.
+            /// @param x X coordinate.
+            /// @param y Y coordinate.
+            bool render(int x, int y);
+
+            /// @brief Renders a part of the region at the coordinates passed.
+            /// @param x X coordinate.
+            /// @param y Y coordinate.
+            /// @param sourceX Source X coordinate relative to the region.
+            /// @param sourceY Source Y coordinate relative to the region.
+            /// @param sourceWidth Source width.
+            /// @param sourceHeight Source height.
+            bool render_part(int x, int y, int sourceX, int sourceY, int sourceWidth, int sourceHeight);
+
+            /// @brief Renders the region stretched at the coordinates passed.
+            /// @param x X coordinate.
+            /// @param y Y coordinate.
+            /// @param width Width to render at.
+            /// @param height Height to render at.
+            bool render_stretched(int x, int y, int width, int height);
+
+        private:
+            /// @brief Page the region belongs to.
+            std::shared_ptr<sdl2::Texture> m_page{};
+
+            /// @brief Region of the page.
+            SDL_Rect m_source{};
+    };
+
+    /// @brief Packs small images into a few large texture pages using a skyline packer.
+    /** @note
+     *  Texture::initialize() must be called before images can be added.
+     */
+    class TextureAtlas final
+    {
+        public:
+            /// @brief Location of a packed image.
+            struct Region
+            {
+                /// @brief Index of the page the image was packed into.
+                int page{};
+
+                /// @brief Rectangle of the image on the page.
+                SDL_Rect source{};
+            };
+
+            /// @brief Default page width.
+            static constexpr int DEFAULT_PAGE_WIDTH = 1024;
+
+            /// @brief Default page height.
+            static constexpr int DEFAULT_PAGE_HEIGHT = 1024;
+
+            /// @brief Creates a new, empty atlas.
+            /// @param pageWidth Width of each page.
+            /// @param pageHeight Height of each page.
+            /// @param padding Transparent pixels left between images to prevent bleeding when scaling.
+            TextureAtlas(int pageWidth = DEFAULT_PAGE_WIDTH, int pageHeight = DEFAULT_PAGE_HEIGHT, int padding = 1);
+
+            /// @brief Loads an image from the path passed and packs it. If the name was already added, the existing region is
+            /// returned.
+            /// @param name Name of the image.
+            /// @param filePath Path to load the image from.
+            sdl2::SubTexture add_image(std::string_view name, std::string_view filePath);
+
+            /// @brief Packs the surface passed. If the name was already added, the existing region is returned.
+            /// @param name Name of the image.
+            /// @param surface Surface to pack.
+            sdl2::SubTexture add_surface(std::string_view name, sdl2::Surface &surface);
+
+            /// @brief Packs the surface passed without naming it.
+            /// @param surface Surface to pack.
+            /// @return Region the surface was packed into. nullopt if it doesn't fit on a page.
+            std::optional<TextureAtlas::Region> pack(sdl2::Surface &surface);
+
+            /// @brief Searches for an image added previously.
+            /// @param name Name of the image.
+            /// @return Handle to the image. Uninitialized if it wasn't found.
+            sdl2::SubTexture find(std::string_view name) const;
+
+            /// @brief Returns the number of pages currently allocated.
+            int get_page_count() const noexcept;
+
+            /// @brief Returns the page at the index passed.
+            /// @param page Index of the page.
+            const std::shared_ptr<sdl2::Texture> &get_page(int page) const noexcept;
+
+        private:
+            // clang-format off
+            /// @brief Single segment of the skyline.
+            struct SkylineNode
+            {
+                int x{};
+                int y{};
+                int width{};
+            };
+
+            /// @brief Page texture and the skyline describing how full it is.
+            struct Page
+            {
+                std::shared_ptr<sdl2::Texture> texture{};
+                std::vector<SkylineNode> skyline{};
+            };
+
+            struct StringViewHash
+            {
+                using is_transparent = void;
+                size_t operator() (std::string_view view) const noexcept { return std::hash<std::string_view>{}(view); }
+            };
+
+            struct StringViewEquals
+            {
+                using is_transparent = void;
+                bool operator() (std::string_view viewA, std::string_view viewB) const noexcept { return viewA == viewB; }
+            };
+            // clang-format on
+
+            /// @brief Width of the pages.
+            int m_pageWidth{};
+
+            /// @brief Height of the pages.
+            int m_pageHeight{};
+
+            /// @brief Padding between images.
+            int m_padding{};
+
+            /// @brief Pages of the atlas.
+            std::vector<TextureAtlas::Page> m_pages{};
+
+            /// @brief Map of named regions.
+            std::unordered_map<std::string, TextureAtlas::Region, StringViewHash, StringViewEquals> m_regionMap{};
+
+            /// @brief Allocates a new, blank page.
+            bool allocate_page();
+
+            /// @brief Attempts to find room for a rectangle on the page passed.
+            /// @param page Page to search.
+            /// @param width Width of the rectangle including padding.
+            /// @param height Height of the rectangle including padding.
+            /// @param rect Set to the location found.
+            /// @return Index of the skyline node the rectangle sits on. -1 if it doesn't fit.
+            int find_position(const TextureAtlas::Page &page, int width, int height, SDL_Rect &rect) const noexcept;
+
+            /// @brief Returns the Y the rectangle would sit at if placed at the node passed. -1 if it doesn't fit.
+            int fit_node(const TextureAtlas::Page &page, size_t nodeIndex, int width, int height) const noexcept;
+
+            /// @brief Inserts the rectangle into the page's skyline.
+            void add_skyline_level(TextureAtlas::Page &page, size_t nodeIndex, const SDL_Rect &rect);
+    };
+}
\ No newline at end of file
@@ -0,0 +1,135 @@
+#pragma once
+#include "Surface.hpp"
+#include "Texture.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace sdl2
+{
+    /// @brief Loads textures in the background. Images are decoded on a worker thread and uploaded on the render thread.
+    /** @note
+     *  Textures returned are registered with the TextureManager under the name passed and stay uninitialized until
+     *  their upload lands. Rendering them before then just renders nothing. Everything here is meant to be called
+     *  from the render thread. Renderer::frame_begin() calls process_uploads().
+     */
+    class TextureLoader final
+    {
+        public:
+            // No copying or moving.
+            TextureLoader(const TextureLoader &)            = delete;
+            TextureLoader(TextureLoader &&)                 = delete;
+            TextureLoader &operator=(const TextureLoader &) = delete;
+            TextureLoader &operator=(TextureLoader &&)      = delete;
+
+            /// @brief Default number of bytes uploaded per frame.
+            static constexpr size_t DEFAULT_UPLOAD_BUDGET = 0x100000;
+
+            /// @brief Returns the texture registered under the name passed, queueing it to load from the path passed if
+            /// it doesn't exist yet.
+            /// @param name Name to register the texture with the TextureManager under.
+            /// @param filePath Path to load the image from.
+            /// @return Texture. Check is_initialized() to see if it's ready.
+            static std::shared_ptr<sdl2::Texture> load_async(std::string_view name, std::string_view filePath);
+
+            /// @brief Returns whether or not the texture passed is still waiting to be decoded or uploaded.
+            /// @param texture Texture to check.
+            static bool is_pending(const std::shared_ptr<sdl2::Texture> &texture);
+
+            /// @brief Returns the number of textures waiting to be decoded or uploaded.
+            static size_t get_pending_count();
+
+            /// @brief Sets the number of bytes of pixels uploaded per frame. At least one texture is uploaded per frame
+            /// regardless.
+            /// @param bytes Budget in bytes.
+            static void set_upload_budget(size_t bytes);
+
+            /// @brief Sets the number of worker threads decoding images. Only has an effect before the first load.
+            /// @param count Number of workers.
+            static void set_worker_count(size_t count);
+
+            /// @brief Uploads decoded images until the budget for the frame runs out. Called by Renderer::frame_begin.
+            static void process_uploads();
+
+            /// @brief Blocks until every pending texture is decoded and uploads them all regardless of the budget.
+            /// @note Meant for loading screens and preloading before the first frame.
+            static void finish_pending();
+
+        private:
+            // clang-format off
+            /// @brief Image waiting to be decoded.
+            struct DecodeJob
+            {
+                const sdl2::Texture *key{};
+                std::weak_ptr<sdl2::Texture> texture{};
+                std::string filePath{};
+            };
+
+            /// @brief Decoded image waiting to be uploaded.
+            struct DecodedImage
+            {
+                const sdl2::Texture *key{};
+                std::weak_ptr<sdl2::Texture> texture{};
+                sdl2::Surface surface{nullptr, SDL_FreeSurface};
+            };
+            // clang-format on
+
+            /// @brief Textures that haven't been uploaded yet. Only touched by the render thread.
+            std::unordered_map<const sdl2::Texture *, std::weak_ptr<sdl2::Texture>> m_pending{};
+
+            /// @brief Bytes uploaded per frame.
+            size_t m_uploadBudget{DEFAULT_UPLOAD_BUDGET};
+
+            /// @brief Guards the queues and exit flag below.
+            std::mutex m_queueLock{};
+
+            /// @brief Wakes the workers when there's something to decode.
+            std::condition_variable m_queueCondition{};
+
+            /// @brief Wakes finish_pending when something was decoded.
+            std::condition_variable m_uploadCondition{};
+
+            /// @brief Images waiting to be decoded.
+            std::deque<TextureLoader::DecodeJob> m_decodeQueue{};
+
+            /// @brief Decoded images waiting to be uploaded.
+            std::deque<TextureLoader::DecodedImage> m_uploadQueue{};
+
+            /// @brief Tells the workers to exit.
+            bool m_exitWorker{};
+
+            /// @brief Number of workers to start. Defaults to every core but the render thread's.
+            size_t m_workerCount{std::max<size_t>(std::thread::hardware_concurrency(), 2) - 1};
+
+            /// @brief Worker threads. Started the first time something is queued.
+            std::vector<std::thread> m_workers{};
+
+            /// @brief Private constructor.
+            TextureLoader() = default;
+
+            /// @brief Stops the worker.
+            ~TextureLoader();
+
+            /// @brief Returns the instance.
+            static TextureLoader &get_instance();
+
+            /// @brief Uploads decoded images until the budget passed runs out.
+            /// @param budget Number of bytes to upload.
+            void upload(size_t budget);
+
+            /// @brief Returns whether or not the texture passed is in the pending map.
+            bool find_pending(const std::shared_ptr<sdl2::Texture> &texture) const;
+
+            /// @brief Decodes images until told to exit.
+            void worker_main();
+    };
+}
\ No newline at end of file
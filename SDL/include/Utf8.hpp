@@ -0,0 +1,30 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <sys/types.h>
+#include <vector>
+
+namespace sdl2
+{
+    /// @brief UTF-8 decoding for the text paths.
+    /** @note
+     *  Text is mostly ASCII, so decode_string checks 16 bytes at a time and widens whole blocks of ASCII at once with
+     *  NEON on the Switch or SSE2 on x86. Other targets fall back to checking 8 bytes at a time in a plain integer.
+     */
+    namespace utf8
+    {
+        /// @brief Decodes a single codepoint.
+        /// @param codepoint Codepoint to write to.
+        /// @param data Data to decode from.
+        /// @param length Number of bytes available.
+        /// @return Number of bytes used. 0 if there's no data. -1 if the sequence is invalid.
+        ssize_t decode(uint32_t *codepoint, const uint8_t *data, size_t length) noexcept;
+
+        /// @brief Decodes every codepoint of the text passed.
+        /// @param text Text to decode.
+        /// @param codepoints Vector to write to. It's overwritten, so it can be reused to avoid allocating.
+        /// @return True if the whole text was decoded. False if decoding stopped at an invalid sequence.
+        bool decode_string(std::string_view text, std::vector<uint32_t> &codepoints);
+    }
+}
\ No newline at end of file
@@ -1,11 +1,22 @@
 #pragma once
 
+#include "AssetPack.hpp"
 #include "Audio.hpp"
 #include "Font.hpp"
+#include "FontRegistry.hpp"
+#include "GlyphRasterizer.hpp"
 #include "Input.hpp"
+#include "PreloadManifest.hpp"
+#include "RenderCache.hpp"
+#include "RenderCounters.hpp"
+#include "RenderTargetPool.hpp"
 #include "Renderer.hpp"
 #include "ResourceManager.hpp"
+#include "ResourceReport.hpp"
 #include "SDL2.hpp"
+#include "ScopedRender.hpp"
 #include "Surface.hpp"
 #include "SystemFont.hpp"
+#include "TextureAtlas.hpp"
+#include "TextureLoader.hpp"
 #include "Window.hpp"
\ No newline at end of file
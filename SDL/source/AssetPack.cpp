@@ -0,0 +1,88 @@
+#include "AssetPack.hpp"
+
+#include "Hash.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+//                      ---- Construction ----
+
+sdl2::AssetPack::AssetPack(std::string_view packPath)
+{
+    std::error_code error{};
+    const size_t packSize = std::filesystem::file_size(packPath, error);
+    if (error || packSize < sizeof(sdl2::pack::Header)) { return; }
+
+    // Entries are read in place. new[] is aligned well enough for that.
+    m_packData = std::make_unique<std::byte[]>(packSize);
+    m_packSize = packSize;
+
+    // One read for the entire pack.
+    std::ifstream packFile{packPath.data(), std::ios::binary};
+    if (!packFile.is_open()) { return; }
+
+    packFile.read(reinterpret_cast<char *>(m_packData.get()), packSize);
+    if (packFile.gcount() != static_cast<std::streamsize>(packSize)) { return; }
+
+    if (!AssetPack::validate()) { return; }
+
+    m_isInitialized = true;
+}
+
+//                      ---- Public Functions ----
+
+std::optional<std::span<const std::byte>> sdl2::AssetPack::find(std::string_view name) const noexcept
+{
+    const uint64_t nameHash = sdl2::fnv1a_64(name);
+
+    // Entries are sorted by hash. Collisions sit next to each other, so they're checked by name.
+    auto compare   = [](const sdl2::pack::Entry &entry, uint64_t hash) { return entry.nameHash < hash; };
+    auto findEntry = std::lower_bound(m_entries.begin(), m_entries.end(), nameHash, compare);
+    for (; findEntry != m_entries.end() && findEntry->nameHash == nameHash; ++findEntry)
+    {
+        const std::string_view entryName = m_names.substr(findEntry->nameOffset, findEntry->nameLength);
+        if (entryName != name) { continue; }
+
+        return std::span<const std::byte>{m_packData.get() + findEntry->dataOffset, findEntry->dataSize};
+    }
+
+    return std::nullopt;
+}
+
+bool sdl2::AssetPack::contains(std::string_view name) const noexcept { return AssetPack::find(name).has_value(); }
+
+size_t sdl2::AssetPack::get_entry_count() const noexcept { return m_entries.size(); }
+
+//                      ---- Private Functions ----
+
+bool sdl2::AssetPack::validate()
+{
+    sdl2::pack::Header header{};
+    std::memcpy(&header, m_packData.get(), sizeof(sdl2::pack::Header));
+    if (header.magic != sdl2::pack::MAGIC || header.version != sdl2::pack::VERSION) { return false; }
+
+    // The index and names need to fit.
+    const uint64_t entriesSize = static_cast<uint64_t>(header.entryCount) * sizeof(sdl2::pack::Entry);
+    const uint64_t namesOffset = sizeof(sdl2::pack::Header) + entriesSize;
+    if (namesOffset + header.namesSize > m_packSize) { return false; }
+
+    const auto *entries = reinterpret_cast<const sdl2::pack::Entry *>(m_packData.get() + sizeof(sdl2::pack::Header));
+    const auto *names   = reinterpret_cast<const char *>(m_packData.get() + namesOffset);
+    m_entries           = std::span<const sdl2::pack::Entry>{entries, header.entryCount};
+    m_names             = std::string_view{names, header.namesSize};
+
+    // Every entry needs to point inside the pack. Checking once here means find doesn't need to.
+    for (const sdl2::pack::Entry &entry : m_entries)
+    {
+        const bool nameValid = static_cast<uint64_t>(entry.nameOffset) + entry.nameLength <= header.namesSize;
+        const bool dataValid = entry.dataOffset <= m_packSize && entry.dataSize <= m_packSize - entry.dataOffset;
+        if (!nameValid || !dataValid) { return false; }
+    }
+
+    auto sorted = [](const sdl2::pack::Entry &entryA, const sdl2::pack::Entry &entryB)
+    { return entryA.nameHash < entryB.nameHash; };
+
+    return std::is_sorted(m_entries.begin(), m_entries.end(), sorted);
+}
\ No newline at end of file
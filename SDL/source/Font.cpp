@@ -1,13 +1,14 @@
 #include "Font.hpp"
 
+#include "FontRegistry.hpp"
+#include "GlyphRasterizer.hpp"
+#include "Utf8.hpp"
 #include "color_compare.hpp"
 
 #include <algorithm>
-#include <filesystem>
-#include <format>
-#include <fstream>
+#include <climits>
+#include <numeric>
 #include <span>
-#include <switch.h>
 
 namespace
 {
@@ -19,43 +20,38 @@ namespace
 sdl2::Font::Font(std::string_view fontPath, int pixelSize)
     : m_pixelSize{pixelSize}
 {
-    // Attempt to get the font size.
-    const size_t fontSize = std::filesystem::file_size(fontPath);
-    if (fontSize == 0) { return; }
-
-    // Allocate buffer.
-    m_fontBuffer = std::make_unique<FT_Byte[]>(fontSize);
-    if (!m_fontBuffer) { return; }
-
-    // Read the file.
-    std::ifstream fontFile{fontPath.data(), std::ios::binary};
-    if (!fontFile.is_open()) { return; }
-
-    fontFile.read(reinterpret_cast<char *>(m_fontBuffer.get()), fontSize);
-    if (fontFile.gcount() != static_cast<int64_t>(fontSize)) { return; }
-
-    // Create the freetype memory face.
-    FT_Error ftError = FT_New_Memory_Face(sm_freetype.m_library, m_fontBuffer.get(), fontSize, 0, &m_fontFace);
-    if (ftError != 0) { return; }
-
-    // Set the pixel sizes.
-    ftError = FT_Set_Pixel_Sizes(m_fontFace, 0, m_pixelSize);
-    if (ftError != 0) { return; }
-
-    m_isInitialized = true;
+    m_isInitialized = Font::load_glyph_set(sdl2::FontRegistry::load_face(fontPath));
 }
 
-sdl2::Font::~Font()
+sdl2::Font::Font(std::span<const std::byte> fontData, int pixelSize)
+    : m_pixelSize{pixelSize}
 {
-    if (!m_fontFace) { return; }
-
-    FT_Done_Face(m_fontFace);
+    m_isInitialized = Font::load_glyph_set(sdl2::FontRegistry::load_face(fontData));
 }
 
+sdl2::Font::~Font() = default;
+
 //                      ---- Public Functions ----
 
 int sdl2::Font::get_pixel_size() const noexcept { return m_pixelSize; }
 
+size_t sdl2::Font::get_byte_size() const noexcept
+{
+    size_t byteSize = m_codepoints.capacity() * sizeof(uint32_t);
+    if (!m_glyphSet) { return byteSize; }
+
+    // The set's pages are split between the fonts using it, and each face's buffer between the sets using it, so a font
+    // that's the only one using them is charged for all of it.
+    const size_t setUsers = m_glyphSet.use_count();
+    size_t setBytes       = m_glyphSet->get_glyph_byte_size();
+    for (const std::shared_ptr<sdl2::FontFace> &face : m_glyphSet->get_faces())
+    {
+        setBytes += face->get_buffer_size() / face.use_count();
+    }
+
+    return byteSize + setBytes / setUsers;
+}
+
 void sdl2::Font::render_text(int x, int y, SDL_Color color, std::string_view text)
 {
     // Need to store this for line breaks.
@@ -64,21 +60,20 @@ void sdl2::Font::render_text(int x, int y, SDL_Color color, std::string_view tex
     // Need to store this too for color changing.
     const SDL_Color originalColor = color;
 
-    const size_t length = text.length();
-    for (size_t i = 0; i < length;)
+    // Nothing past the bottom of the visible area can be seen.
+    const int visibleBottom = Font::get_visible_bottom();
+
+    // Decoding stops at anything invalid, so only what came before it is drawn.
+    sdl2::utf8::decode_string(text, m_codepoints);
+    for (const uint32_t codepoint : m_codepoints)
     {
-        // Cast to uint8_t since that's what libnx prefers.
-        const uint8_t *string = reinterpret_cast<const uint8_t *>(&text[i]);
-
-        // Decode the codepoint.
-        uint32_t codepoint{};
-        ssize_t unitCount = decode_utf8(&codepoint, string);
-        i += unitCount <= 0 ? 0 : unitCount;
-        if (unitCount <= 0) { break; } // Break the loop since something funky happened.
-        else if (codepoint == LINE_BREAK)
+        if (codepoint == LINE_BREAK)
         {
             x = originalX;
             y += m_pixelSize * 1.25;
+
+            // Glyphs can poke a little above their line, so give it a line's worth of room.
+            if (y - m_pixelSize > visibleBottom) { break; }
             continue;
         }
         else if (Font::is_color_point(codepoint))
@@ -99,9 +94,7 @@ void sdl2::Font::render_text(int x, int y, SDL_Color color, std::string_view tex
             const int renderX = x + (glyphData.left);
             const int renderY = y + (m_pixelSize - glyphData.top);
 
-            // Set render color.
-            glyphData.texture->set_color_mod(color);
-            glyphData.texture->render(renderX, renderY);
+            Font::render_glyph(glyphData.page, glyphData.source, renderX, renderY, color);
         }
 
         // Move our rendering point.
@@ -111,232 +104,282 @@ void sdl2::Font::render_text(int x, int y, SDL_Color color, std::string_view tex
 
 void sdl2::Font::render_text_wrapped(int x, int y, SDL_Color color, int maxWidth, std::string_view text)
 {
-    // Store this for later.
-    const int originalX           = x;
-    const SDL_Color originalColor = color;
-
-    // Adjusted max position.
-    const int maxPosition = x + maxWidth;
+    const sdl2::TextLayout &layout = Font::get_layout(text, maxWidth);
+    Font::render_layout(layout, x, y, color);
+}
 
-    // Width of the current line we're rendering.
-    int currentWidth{};
+sdl2::TextLayout sdl2::Font::create_layout(std::string_view text, int maxWidth)
+{
+    sdl2::TextLayout layout{};
 
-    // For the loop.
-    const int textLength = text.length();
+    // Everything is relative to the origin of the layout.
+    int x{};
+    int y{};
 
     // This is a laziness I mean repetition thing.
     auto break_line = [&]()
     {
-        x = originalX;
+        x = 0;
         y += m_pixelSize * 1.25;
-        currentWidth = 0;
     };
 
-    for (int i = 0; i < textLength;)
-    {
-        // Find the next breakpoint.
-        const size_t nextBreakpoint = Font::find_next_breakpoint(text.substr(i));
+    // Everything is decoded once up front. Words are measured and laid out from the same codepoints.
+    sdl2::utf8::decode_string(text, m_codepoints);
+    const std::span<const uint32_t> codepoints{m_codepoints};
 
-        // Store the substring as a word.
-        const std::string_view word = text.substr(i, nextBreakpoint);
+    for (size_t i = 0; i < codepoints.size();)
+    {
+        // Everything up to and including the next breakpoint is a word.
+        const std::span<const uint32_t> remaining = codepoints.subspan(i);
+        const std::span<const uint32_t> word      = remaining.first(Font::find_next_breakpoint(remaining));
 
         // Grab the width and see if we need to break the line.
-        const int wordWidth = Font::get_text_width(word);
-        if (x + wordWidth >= maxPosition) { break_line(); }
+        const int wordWidth = Font::get_codepoints_width(word);
+        if (x + wordWidth >= maxWidth) { break_line(); }
 
-        // Word render loop.
-        const int wordLength = word.length();
-        for (int j = 0; j < wordLength;)
+        // Word layout loop.
+        for (const uint32_t codepoint : word)
         {
-            uint32_t codepoint{};
-            const uint8_t *point    = reinterpret_cast<const uint8_t *>(&word[j]);
-            const ssize_t unitCount = decode_utf8(&codepoint, point);
-            j += unitCount <= 0 ? 0 : unitCount;
-            if (unitCount <= 0) { break; }
-            else if (codepoint == LINE_BREAK)
+            if (codepoint == LINE_BREAK)
             {
                 break_line();
                 continue;
             }
             else if (Font::is_color_point(codepoint))
             {
-                Font::change_text_color(codepoint, originalColor, color);
+                layout.m_colorSpans.push_back({.firstGlyph = layout.m_glyphs.size(), .codepoint = codepoint});
                 continue;
             }
 
             const auto getGlyph = find_load_glyph(codepoint);
             if (!getGlyph.has_value()) { continue; }
 
-            Font::GlyphData &glyphData = getGlyph->get();
-            if (codepoint != L' ')
+            const Font::GlyphData &glyphData = getGlyph->get();
+            if (codepoint != L' ' && glyphData.page >= 0)
             {
-                const int renderX = x + glyphData.left;
-                const int renderY = y + (m_pixelSize - glyphData.top);
-
-                glyphData.texture->set_color_mod(color);
-                glyphData.texture->render(renderX, renderY);
+                const TextLayout::Glyph glyph = {.x      = x + glyphData.left,
+                                                 .y      = y + (m_pixelSize - glyphData.top),
+                                                 .page   = glyphData.page,
+                                                 .source = glyphData.source};
+                layout.m_glyphs.push_back(glyph);
             }
 
             x += glyphData.advanceX;
+            layout.m_width = std::max(layout.m_width, x);
         }
 
         // Realign.
-        i += wordLength;
-        currentWidth += wordWidth;
+        i += word.size();
     }
+
+    layout.m_height = y + m_pixelSize * 1.25;
+    return layout;
 }
 
-int sdl2::Font::get_text_width(std::string_view text)
+const sdl2::TextLayout &sdl2::Font::get_layout(std::string_view text, int maxWidth)
 {
-    // This is what we're returning.
-    int textWidth{};
-
-    const int textLength = text.length();
-    for (int i = 0; i < textLength;)
+    // Layouts created before the break or color points changed or before skipped glyphs landed can't be trusted anymore.
+    const uint32_t glyphGeneration = m_glyphSet ? m_glyphSet->get_generation() : 0;
+    if (m_layoutGeneration != sm_pointGeneration || m_layoutGlyphGeneration != glyphGeneration)
     {
-        uint32_t codepoint{};
-        const uint8_t *point    = reinterpret_cast<const uint8_t *>(&text[i]);
-        const ssize_t unitCount = decode_utf8(&codepoint, point);
+        m_layoutCache.clear();
+        m_layoutGeneration      = sm_pointGeneration;
+        m_layoutGlyphGeneration = glyphGeneration;
+    }
 
-        i += unitCount <= 0 ? 0 : unitCount;
-        if (unitCount <= 0) { return textWidth; }
-        else if (codepoint == LINE_BREAK) { continue; } // Ignore line breaks.
+    const sdl2::TextLayout *cachedLayout = m_layoutCache.find(text, maxWidth);
+    if (cachedLayout) { return *cachedLayout; }
 
-        // Load glyph.
-        const auto getGlyph = find_load_glyph(codepoint);
-        if (!getGlyph.has_value()) { continue; }
+    return m_layoutCache.insert(text, maxWidth, Font::create_layout(text, maxWidth));
+}
 
-        const Font::GlyphData &glyphData = getGlyph->get();
-        textWidth += glyphData.advanceX;
+void sdl2::Font::render_layout(const sdl2::TextLayout &layout, int x, int y, SDL_Color color)
+{
+    // Need to store this too for color changing.
+    const SDL_Color originalColor = color;
+
+    const std::vector<TextLayout::ColorSpan> &colorSpans = layout.m_colorSpans;
+    const size_t spanCount                               = colorSpans.size();
+
+    // Glyphs are laid out line by line, so everything after the first glyph well past the bottom is invisible too.
+    // Glyphs on the same line can sit up to about a line above or below each other, hence the room.
+    const int visibleBottom = Font::get_visible_bottom();
+    const int stopY         = visibleBottom == INT_MAX ? INT_MAX : visibleBottom + (m_pixelSize * 2);
+
+    size_t currentSpan{};
+    const size_t glyphCount = layout.m_glyphs.size();
+    for (size_t i = 0; i < glyphCount; i++)
+    {
+        // Apply every color change that happened before this glyph.
+        for (; currentSpan < spanCount && colorSpans[currentSpan].firstGlyph == i; currentSpan++)
+        {
+            Font::change_text_color(colorSpans[currentSpan].codepoint, originalColor, color);
+        }
+
+        const TextLayout::Glyph &glyph = layout.m_glyphs[i];
+        if (y + glyph.y > stopY) { break; }
+
+        Font::render_glyph(glyph.page, glyph.source, x + glyph.x, y + glyph.y, color);
     }
+}
 
-    return textWidth;
+void sdl2::Font::set_layout_cache_size(size_t capacity) { m_layoutCache.set_capacity(capacity); }
+
+int sdl2::Font::get_text_width(std::string_view text)
+{
+    sdl2::utf8::decode_string(text, m_codepoints);
+    return Font::get_codepoints_width(m_codepoints);
 }
 
 //                      ---- Public, static functions ----
 
-void sdl2::Font::add_break_point(uint32_t codepoint) { sm_breakPoints.push_back(codepoint); }
+void sdl2::Font::prewarm(std::string_view text)
+{
+    sdl2::utf8::decode_string(text, m_codepoints);
+    sdl2::GlyphRasterizer::queue(m_glyphSet, m_codepoints);
+}
+
+void sdl2::Font::prewarm(std::span<const std::string_view> strings)
+{
+    // Gathered first so the glyphs are split into jobs together instead of a few per string.
+    std::vector<uint32_t> codepoints{};
+    for (const std::string_view text : strings)
+    {
+        sdl2::utf8::decode_string(text, m_codepoints);
+        codepoints.insert(codepoints.end(), m_codepoints.begin(), m_codepoints.end());
+    }
+
+    sdl2::GlyphRasterizer::queue(m_glyphSet, codepoints);
+}
+
+void sdl2::Font::prewarm_range(uint32_t first, uint32_t last)
+{
+    if (last < first) { return; }
+
+    std::vector<uint32_t> codepoints(last - first + 1);
+    std::iota(codepoints.begin(), codepoints.end(), first);
+    sdl2::GlyphRasterizer::queue(m_glyphSet, codepoints);
+}
+
+void sdl2::Font::add_break_point(uint32_t codepoint)
+{
+    Font::insert_break_point(codepoint);
+    ++sm_pointGeneration;
+}
 
 void sdl2::Font::add_break_points(std::initializer_list<const uint32_t> pointList)
 {
-    for (uint32_t point : pointList) { sm_breakPoints.push_back(point); }
+    for (uint32_t point : pointList) { Font::insert_break_point(point); }
+    ++sm_pointGeneration;
 }
 
 void sdl2::Font::add_break_points(std::span<const uint32_t> pointSpan)
 {
-    for (uint32_t point : pointSpan) { sm_breakPoints.push_back(point); }
+    for (uint32_t point : pointSpan) { Font::insert_break_point(point); }
+    ++sm_pointGeneration;
 }
 
 void sdl2::Font::add_color_point(uint32_t codepoint, SDL_Color color)
-{ sm_colorPoints.push_back(std::make_pair(codepoint, color)); }
+{
+    Font::insert_color_point(codepoint, color);
+    ++sm_pointGeneration;
+}
 
 void sdl2::Font::add_color_points(std::initializer_list<const std::pair<uint32_t, SDL_Color>> pointList)
 {
-    for (const auto &pair : pointList) { sm_colorPoints.push_back(pair); }
+    for (const auto &[codepoint, color] : pointList) { Font::insert_color_point(codepoint, color); }
+    ++sm_pointGeneration;
 }
 
 void sdl2::Font::add_color_points(std::span<const std::pair<uint32_t, SDL_Color>> pointSpan)
 {
-    for (const auto &pair : pointSpan) { sm_colorPoints.push_back(pair); }
+    for (const auto &[codepoint, color] : pointSpan) { Font::insert_color_point(codepoint, color); }
+    ++sm_pointGeneration;
 }
 
 //                      ---- Protected Functions ----
 
-OptionalReference<sdl2::Font::GlyphData> sdl2::Font::find_load_glyph(uint32_t codepoint)
+bool sdl2::Font::load_glyph_set(std::shared_ptr<sdl2::FontFace> face)
 {
-    // Search for the glyph first.
-    const auto findGlyph = m_cacheMap.find(codepoint);
-    if (findGlyph != m_cacheMap.end()) { return findGlyph->second; }
-
-    // Get the character index.
-    FT_UInt glyphIndex = FT_Get_Char_Index(m_fontFace, codepoint);
-    if (glyphIndex <= 0) { return std::nullopt; }
+    if (!face || !face->is_initialized()) { return false; }
 
-    // Load and render the glyph.
-    FT_Error ftError = FT_Load_Glyph(m_fontFace, glyphIndex, FT_LOAD_RENDER);
-    if (ftError != 0) { return std::nullopt; }
-
-    // Make things easier to type and read.
-    const FT_GlyphSlot glyphSlot = m_fontFace->glyph;
-    const FT_Bitmap glyphBitmap  = glyphSlot->bitmap;
-
-    // Convert to texture.
-    sdl2::SharedTexture glyphTexture = Font::convert_glyph_to_texture(codepoint, glyphBitmap);
-
-    // Cache data.
-    const Font::GlyphData cacheData = {.advanceX = static_cast<int16_t>(glyphSlot->advance.x >> 6),
-                                       .top      = static_cast<int16_t>(glyphSlot->bitmap_top),
-                                       .left     = static_cast<int16_t>(glyphSlot->bitmap_left),
-                                       .texture  = glyphTexture};
+    const std::shared_ptr<sdl2::FontFace> faces[] = {std::move(face)};
+    m_glyphSet                                    = sdl2::FontRegistry::get_glyph_set(faces, m_pixelSize);
+    return m_glyphSet->is_initialized();
+}
 
-    // Map is weird and returns this as a pair?
-    const auto emplacePair = m_cacheMap.try_emplace(codepoint, cacheData);
-    if (!emplacePair.second) { return std::nullopt; }
+OptionalReference<const sdl2::Font::GlyphData> sdl2::Font::find_load_glyph(uint32_t codepoint)
+{
+    if (!m_glyphSet) { return std::nullopt; }
 
-    // Finally return.
-    return m_cacheMap.at(codepoint);
+    return m_glyphSet->find_load_glyph(codepoint);
 }
 
-sdl2::SharedTexture sdl2::Font::convert_glyph_to_texture(uint32_t codepoint, const FT_Bitmap glyphBitmap)
+void sdl2::Font::render_glyph(int page, const SDL_Rect &source, int x, int y, SDL_Color color)
 {
-    // Base pixel color for constructing pixels.
-    static constexpr uint32_t BASE_PIXEL_COLOR = 0xFFFFFF00;
-
-    // This makes things easier to read later.
-    const size_t bitmapSize = glyphBitmap.width * glyphBitmap.rows;
+    const std::shared_ptr<sdl2::Texture> &pageTexture = m_glyphSet->get_page(page);
+    if (!pageTexture) { return; }
 
-    // Surface to construct on.
-    sdl2::Surface glyphSurface = sdl2::surface::create_rgb(glyphBitmap.width, glyphBitmap.rows);
-    if (!glyphSurface) { return nullptr; } // To do: Something better here.
+    pageTexture->set_color_mod(color);
+    pageTexture->render_part(x, y, source.x, source.y, source.w, source.h);
+}
 
-    // Spans for constructing pixels.
-    std::span<uint32_t> surfacePixels{reinterpret_cast<uint32_t *>(glyphSurface->pixels), bitmapSize};
-    std::span<const uint8_t> bitmapPixels{glyphBitmap.buffer, bitmapSize};
+//                      ---- Private Functions ----
 
-    // Loop and construct glyph.
-    for (size_t i = 0; i < bitmapSize; i++) { surfacePixels[i] = BASE_PIXEL_COLOR | bitmapPixels[i]; }
+size_t sdl2::Font::find_next_breakpoint(std::span<const uint32_t> codepoints) const noexcept
+{
+    const size_t codepointCount = codepoints.size();
+    for (size_t i = 0; i < codepointCount; i++)
+    {
+        if (Font::is_breakpoint(codepoints[i])) { return i + 1; }
+    }
 
-    // Name for the glyph.
-    const std::string glyphName = std::format("{:08x} - {}", codepoint, m_pixelSize);
-    return sdl2::TextureManager::create_load_resource(glyphName, glyphSurface);
+    return codepointCount;
 }
 
-//                      ---- Private Functions ----
-
-size_t sdl2::Font::find_next_breakpoint(std::string_view string)
+int sdl2::Font::get_codepoints_width(std::span<const uint32_t> codepoints)
 {
-    const int stringLength = string.length();
-    for (int i = 0; i < stringLength;)
+    // This is what we're returning.
+    int textWidth{};
+
+    for (const uint32_t codepoint : codepoints)
     {
-        uint32_t codepoint{};
-        const uint8_t *nextPoint = reinterpret_cast<const uint8_t *>(&string[i]);
+        // Ignore line breaks.
+        if (codepoint == LINE_BREAK) { continue; }
 
-        const ssize_t unitCount = decode_utf8(&codepoint, nextPoint);
-        if (unitCount <= 0) { return string.npos; }
-        else if (Font::is_breakpoint(codepoint)) { return i + unitCount; }
+        // Load glyph.
+        const auto getGlyph = find_load_glyph(codepoint);
+        if (!getGlyph.has_value()) { continue; }
 
-        i += unitCount;
+        const Font::GlyphData &glyphData = getGlyph->get();
+        textWidth += glyphData.advanceX;
     }
-    return string.npos;
+
+    return textWidth;
 }
 
 bool sdl2::Font::is_breakpoint(uint32_t codepoint) const noexcept
 {
-    auto match = [=](const uint32_t point) { return point == codepoint; };
-    return std::find_if(sm_breakPoints.begin(), sm_breakPoints.end(), match) != sm_breakPoints.end();
+    if (codepoint < BMP_SIZE) { return sm_breakBits.test(codepoint); }
+
+    return std::binary_search(sm_breakPoints.begin(), sm_breakPoints.end(), codepoint);
 }
 
 bool sdl2::Font::is_color_point(uint32_t codepoint) const noexcept
 {
-    auto match = [=](const auto &pair) { return pair.first == codepoint; };
-    return std::find_if(sm_colorPoints.begin(), sm_colorPoints.end(), match) != sm_colorPoints.end();
+    if (codepoint < BMP_SIZE) { return sm_colorBits.test(codepoint); }
+
+    auto lessThan = [](const auto &pair, uint32_t point) { return pair.first < point; };
+    auto findPair = std::lower_bound(sm_colorPoints.begin(), sm_colorPoints.end(), codepoint, lessThan);
+    return findPair != sm_colorPoints.end() && findPair->first == codepoint;
 }
 
 SDL_Color sdl2::Font::get_point_color(uint32_t codepoint) const noexcept
 {
-    auto match    = [=](const auto &pair) { return pair.first == codepoint; };
-    auto findPair = std::find_if(sm_colorPoints.begin(), sm_colorPoints.end(), match);
-    if (findPair == sm_colorPoints.end()) { return static_cast<SDL_Color>(0); }
+    // This is only reached for codepoints already known to change color, so a binary search is fine here.
+    auto lessThan = [](const auto &pair, uint32_t point) { return pair.first < point; };
+    auto findPair = std::lower_bound(sm_colorPoints.begin(), sm_colorPoints.end(), codepoint, lessThan);
+    if (findPair == sm_colorPoints.end() || findPair->first != codepoint) { return static_cast<SDL_Color>(0); }
 
     return findPair->second;
 }
@@ -345,4 +388,39 @@ void sdl2::Font::change_text_color(uint32_t codepoint, SDL_Color originalColor,
 {
     const SDL_Color pointColor = Font::get_point_color(codepoint);
     renderColor                = renderColor == originalColor ? pointColor : originalColor;
+}
+
+void sdl2::Font::insert_break_point(uint32_t codepoint)
+{
+    if (codepoint < BMP_SIZE)
+    {
+        sm_breakBits.set(codepoint);
+        return;
+    }
+
+    auto findPoint = std::lower_bound(sm_breakPoints.begin(), sm_breakPoints.end(), codepoint);
+    if (findPoint != sm_breakPoints.end() && *findPoint == codepoint) { return; }
+
+    sm_breakPoints.insert(findPoint, codepoint);
+}
+
+void sdl2::Font::insert_color_point(uint32_t codepoint, SDL_Color color)
+{
+    auto lessThan  = [](const auto &pair, uint32_t point) { return pair.first < point; };
+    auto findPoint = std::lower_bound(sm_colorPoints.begin(), sm_colorPoints.end(), codepoint, lessThan);
+    if (findPoint != sm_colorPoints.end() && findPoint->first == codepoint) { return; }
+
+    sm_colorPoints.insert(findPoint, std::make_pair(codepoint, color));
+    if (codepoint < BMP_SIZE) { sm_colorBits.set(codepoint); }
+}
+
+int sdl2::Font::get_visible_bottom() noexcept
+{
+    const sdl2::Renderer *renderer = sdl2::Texture::get_renderer();
+    if (!renderer) { return INT_MAX; }
+
+    const std::optional<SDL_Rect> visibleRect = renderer->get_visible_rect();
+    if (!visibleRect.has_value()) { return INT_MAX; }
+
+    return visibleRect->y + visibleRect->h;
 }
\ No newline at end of file
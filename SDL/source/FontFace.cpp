@@ -0,0 +1,83 @@
+#include "FontFace.hpp"
+
+#include <filesystem>
+#include <fstream>
+
+//                      ---- Construction ----
+
+sdl2::FontFace::FontFace(std::string_view fontPath)
+{
+    // Attempt to get the font size.
+    const size_t fontSize = std::filesystem::file_size(fontPath);
+    if (fontSize == 0) { return; }
+
+    // Allocate buffer.
+    m_fontBuffer = std::make_unique<FT_Byte[]>(fontSize);
+    if (!m_fontBuffer) { return; }
+
+    // Read the file.
+    std::ifstream fontFile{fontPath.data(), std::ios::binary};
+    if (!fontFile.is_open()) { return; }
+
+    fontFile.read(reinterpret_cast<char *>(m_fontBuffer.get()), fontSize);
+    if (fontFile.gcount() != static_cast<int64_t>(fontSize)) { return; }
+
+    m_fontBufferSize = fontSize;
+    m_isInitialized  = FontFace::create_face(m_fontBuffer.get(), fontSize);
+}
+
+sdl2::FontFace::FontFace(std::span<const std::byte> fontData)
+{
+    const FT_Byte *data = reinterpret_cast<const FT_Byte *>(fontData.data());
+    m_isInitialized     = FontFace::create_face(data, fontData.size());
+}
+
+sdl2::FontFace::~FontFace()
+{
+    if (!m_face) { return; }
+
+    std::lock_guard<std::mutex> libraryGuard{sm_libraryLock};
+    FT_Done_Face(m_face);
+}
+
+//                      ---- Public Functions ----
+
+FT_Face sdl2::FontFace::get() const noexcept { return m_face; }
+
+std::mutex &sdl2::FontFace::get_lock() const noexcept { return m_faceLock; }
+
+size_t sdl2::FontFace::get_buffer_size() const noexcept { return m_fontBufferSize; }
+
+std::span<const std::byte> sdl2::FontFace::get_data() const noexcept { return m_fontData; }
+
+std::span<const sdl2::CoverageRange> sdl2::FontFace::get_coverage() const noexcept { return m_coverage; }
+
+//                      ---- Private Functions ----
+
+bool sdl2::FontFace::create_face(const FT_Byte *fontData, size_t dataSize)
+{
+    {
+        std::lock_guard<std::mutex> libraryGuard{sm_libraryLock};
+        const FT_Error ftError = FT_New_Memory_Face(sm_freetype.m_library, fontData, dataSize, 0, &m_face);
+        if (ftError != 0) { return false; }
+    }
+
+    m_fontData = {reinterpret_cast<const std::byte *>(fontData), dataSize};
+    FontFace::build_coverage();
+    return true;
+}
+
+void sdl2::FontFace::build_coverage()
+{
+    // The character map is walked in increasing order, so consecutive codepoints extend the last range.
+    FT_UInt glyphIndex{};
+    FT_ULong codepoint = FT_Get_First_Char(m_face, &glyphIndex);
+    while (glyphIndex != 0)
+    {
+        const uint32_t point = static_cast<uint32_t>(codepoint);
+        if (!m_coverage.empty() && m_coverage.back().last + 1 == point) { m_coverage.back().last = point; }
+        else { m_coverage.push_back({.first = point, .last = point}); }
+
+        codepoint = FT_Get_Next_Char(m_face, codepoint, &glyphIndex);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,96 @@
+#include "FontRegistry.hpp"
+
+//                      ---- Public Functions ----
+
+std::shared_ptr<sdl2::FontFace> sdl2::FontRegistry::load_face(std::string_view fontPath)
+{
+    FontRegistry &instance = FontRegistry::get_instance();
+    std::lock_guard<std::mutex> registryGuard{instance.m_registryLock};
+
+    const auto findFace = instance.m_fileFaces.find(fontPath);
+    if (findFace != instance.m_fileFaces.end())
+    {
+        std::shared_ptr<sdl2::FontFace> face = findFace->second.lock();
+        if (face) { return face; }
+    }
+
+    auto face = std::make_shared<sdl2::FontFace>(fontPath);
+    instance.m_fileFaces.insert_or_assign(std::string{fontPath}, face);
+    return face;
+}
+
+std::shared_ptr<sdl2::FontFace> sdl2::FontRegistry::load_face(std::span<const std::byte> fontData)
+{
+    FontRegistry &instance = FontRegistry::get_instance();
+    std::lock_guard<std::mutex> registryGuard{instance.m_registryLock};
+
+    const auto findFace = instance.m_memoryFaces.find(fontData.data());
+    if (findFace != instance.m_memoryFaces.end())
+    {
+        std::shared_ptr<sdl2::FontFace> face = findFace->second.lock();
+        if (face) { return face; }
+    }
+
+    auto face = std::make_shared<sdl2::FontFace>(fontData);
+    instance.m_memoryFaces.insert_or_assign(fontData.data(), face);
+    return face;
+}
+
+std::shared_ptr<sdl2::GlyphSet> sdl2::FontRegistry::get_glyph_set(std::span<const std::shared_ptr<sdl2::FontFace>> faces,
+                                                                  int pixelSize)
+{
+    FontRegistry &instance = FontRegistry::get_instance();
+    std::lock_guard<std::mutex> registryGuard{instance.m_registryLock};
+
+    FontRegistry::GlyphSetKey key{};
+    key.second = pixelSize;
+    for (const std::shared_ptr<sdl2::FontFace> &face : faces) { key.first.push_back(face.get()); }
+
+    const auto findSet = instance.m_glyphSets.find(key);
+    if (findSet != instance.m_glyphSets.end())
+    {
+        std::shared_ptr<sdl2::GlyphSet> glyphSet = findSet->second.lock();
+        if (glyphSet) { return glyphSet; }
+    }
+
+    auto glyphSet = std::make_shared<sdl2::GlyphSet>(faces, pixelSize);
+    instance.m_glyphSets.insert_or_assign(std::move(key), glyphSet);
+    return glyphSet;
+}
+
+sdl2::FontRegistryStats sdl2::FontRegistry::get_stats()
+{
+    FontRegistry &instance = FontRegistry::get_instance();
+    std::lock_guard<std::mutex> registryGuard{instance.m_registryLock};
+
+    sdl2::FontRegistryStats stats{};
+    auto countFace = [&](const std::weak_ptr<sdl2::FontFace> &weakFace)
+    {
+        std::shared_ptr<sdl2::FontFace> face = weakFace.lock();
+        if (!face) { return; }
+
+        ++stats.faceCount;
+        stats.faceBytes += face->get_buffer_size();
+    };
+    for (const auto &[path, face] : instance.m_fileFaces) { countFace(face); }
+    for (const auto &[data, face] : instance.m_memoryFaces) { countFace(face); }
+
+    for (const auto &[key, weakSet] : instance.m_glyphSets)
+    {
+        std::shared_ptr<sdl2::GlyphSet> glyphSet = weakSet.lock();
+        if (!glyphSet) { continue; }
+
+        ++stats.glyphSetCount;
+        stats.glyphBytes += glyphSet->get_glyph_byte_size();
+    }
+
+    return stats;
+}
+
+//                      ---- Private Functions ----
+
+sdl2::FontRegistry &sdl2::FontRegistry::get_instance()
+{
+    static FontRegistry instance;
+    return instance;
+}
\ No newline at end of file
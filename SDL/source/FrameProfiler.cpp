@@ -0,0 +1,228 @@
+#include "FrameProfiler.hpp"
+
+#include "Font.hpp"
+#include "Renderer.hpp"
+
+#include <algorithm>
+#include <format>
+#include <fstream>
+#include <string>
+
+namespace
+{
+    /// @brief Colors used for the overlay.
+    constexpr SDL_Color OVERLAY_BACKGROUND = {.r = 0x00, .g = 0x00, .b = 0x00, .a = 0xC0};
+    constexpr SDL_Color OVERLAY_TEXT       = {.r = 0xFF, .g = 0xFF, .b = 0xFF, .a = 0xFF};
+    constexpr SDL_Color OVERLAY_BAR        = {.r = 0x00, .g = 0xFF, .b = 0x80, .a = 0xFF};
+
+    /// @brief Padding around the overlay contents.
+    constexpr int OVERLAY_PADDING = 4;
+
+    /// @brief Size of the histogram bars.
+    constexpr int BAR_WIDTH  = 4;
+    constexpr int BAR_HEIGHT = 24;
+}
+
+//                      ---- Construction ----
+
+sdl2::FrameProfiler::FrameProfiler()
+    : m_startCounter{SDL_GetPerformanceCounter()} {}
+
+//                      ---- Public Functions ----
+
+void sdl2::FrameProfiler::set_enabled(bool enabled) noexcept
+{
+    // Start fresh so the first frame after enabling isn't measured from a stale present.
+    if (enabled && !m_isEnabled)
+    {
+        m_presentEnd = 0;
+        m_frameCount = 0;
+    }
+
+    m_isEnabled = enabled;
+}
+
+bool sdl2::FrameProfiler::is_enabled() const noexcept { return m_isEnabled; }
+
+void sdl2::FrameProfiler::frame_begin() noexcept
+{
+    if (!m_isEnabled) { return; }
+
+    m_frameBegin = SDL_GetPerformanceCounter();
+}
+
+void sdl2::FrameProfiler::present_begin() noexcept
+{
+    if (!m_isEnabled) { return; }
+
+    m_presentBegin = SDL_GetPerformanceCounter();
+}
+
+void sdl2::FrameProfiler::present_end() noexcept
+{
+    // The first frame is recorded no matter what.
+    if (m_timeToFirstFrame == 0.0f)
+    {
+        m_timeToFirstFrame = FrameProfiler::to_milliseconds(SDL_GetPerformanceCounter() - m_startCounter);
+    }
+
+    if (!m_isEnabled) { return; }
+
+    const uint64_t presentEnd = SDL_GetPerformanceCounter();
+
+    // The very first frame doesn't have a previous present to measure the update from.
+    if (m_presentEnd != 0 && m_frameBegin >= m_presentEnd && m_presentBegin >= m_frameBegin)
+    {
+        FrameProfiler::FrameTiming &timing = m_history[m_frameCount % HISTORY_LENGTH];
+        timing.update                      = FrameProfiler::to_milliseconds(m_frameBegin - m_presentEnd);
+        timing.render                      = FrameProfiler::to_milliseconds(m_presentBegin - m_frameBegin);
+        timing.present                     = FrameProfiler::to_milliseconds(presentEnd - m_presentBegin);
+        timing.frame                       = FrameProfiler::to_milliseconds(presentEnd - m_presentEnd);
+        ++m_frameCount;
+    }
+
+    m_presentEnd = presentEnd;
+}
+
+uint64_t sdl2::FrameProfiler::get_frame_count() const noexcept { return m_frameCount; }
+
+float sdl2::FrameProfiler::get_time_to_first_frame() const noexcept { return m_timeToFirstFrame; }
+
+sdl2::FrameProfiler::FrameTiming sdl2::FrameProfiler::get_last_frame() const noexcept
+{
+    if (m_frameCount == 0) { return {}; }
+
+    return m_history[(m_frameCount - 1) % HISTORY_LENGTH];
+}
+
+sdl2::FrameProfiler::Statistics sdl2::FrameProfiler::get_statistics(FrameProfiler::Phase phase) const noexcept
+{
+    const size_t historySize = FrameProfiler::get_history_size();
+    if (historySize == 0) { return {}; }
+
+    // Copy the values so they can be sorted.
+    std::array<float, HISTORY_LENGTH> values{};
+    float total{};
+    for (size_t i = 0; i < historySize; i++)
+    {
+        values[i] = FrameProfiler::get_phase(m_history[i], phase);
+        total += values[i];
+    }
+    std::sort(values.begin(), values.begin() + historySize);
+
+    // Nearest rank.
+    auto percentile = [&](size_t percent) { return values[((historySize - 1) * percent) / 100]; };
+
+    return {.average      = total / historySize,
+            .minimum      = values[0],
+            .median       = percentile(50),
+            .percentile95 = percentile(95),
+            .percentile99 = percentile(99),
+            .maximum      = values[historySize - 1]};
+}
+
+std::array<uint32_t, sdl2::FrameProfiler::HISTOGRAM_BUCKETS> sdl2::FrameProfiler::get_histogram() const noexcept
+{
+    std::array<uint32_t, HISTOGRAM_BUCKETS> histogram{};
+
+    const size_t historySize = FrameProfiler::get_history_size();
+    for (size_t i = 0; i < historySize; i++)
+    {
+        const size_t bucket = m_history[i].frame / HISTOGRAM_BUCKET_WIDTH;
+        ++histogram[std::min(bucket, HISTOGRAM_BUCKETS - 1)];
+    }
+
+    return histogram;
+}
+
+void sdl2::FrameProfiler::render_overlay(sdl2::Renderer &renderer, sdl2::Font &font, int x, int y) const
+{
+    const FrameProfiler::FrameTiming last = FrameProfiler::get_last_frame();
+    const FrameProfiler::Statistics frame = FrameProfiler::get_statistics(FrameProfiler::Phase::Frame);
+
+    const std::array<std::string, 6> lines = {
+        std::format("First frame: {:.2f} ms", m_timeToFirstFrame),
+        std::format("Frame: {:.2f} ms", last.frame),
+        std::format("Update: {:.2f} ms", last.update),
+        std::format("Render: {:.2f} ms", last.render),
+        std::format("Present: {:.2f} ms", last.present),
+        std::format("p50/p95/p99: {:.2f}/{:.2f}/{:.2f} ms", frame.median, frame.percentile95, frame.percentile99)};
+
+    // Size the background to the text and histogram.
+    const int lineHeight = font.get_pixel_size() * 1.25;
+    int width            = BAR_WIDTH * HISTOGRAM_BUCKETS;
+    for (const std::string &line : lines) { width = std::max(width, font.get_text_width(line)); }
+
+    const int textHeight = lineHeight * lines.size();
+    const int height     = textHeight + BAR_HEIGHT + OVERLAY_PADDING;
+    renderer.render_rectangle(x, y, width + OVERLAY_PADDING * 2, height + OVERLAY_PADDING * 2, OVERLAY_BACKGROUND);
+
+    int textY = y + OVERLAY_PADDING;
+    for (const std::string &line : lines)
+    {
+        font.render_text(x + OVERLAY_PADDING, textY, OVERLAY_TEXT, line);
+        textY += lineHeight;
+    }
+
+    // Histogram bars are scaled to the fullest bucket.
+    const auto histogram   = FrameProfiler::get_histogram();
+    const uint32_t tallest = std::max<uint32_t>(*std::max_element(histogram.begin(), histogram.end()), 1);
+    const int barBottom    = textY + OVERLAY_PADDING + BAR_HEIGHT;
+    for (size_t i = 0; i < HISTOGRAM_BUCKETS; i++)
+    {
+        const int barHeight = (histogram[i] * BAR_HEIGHT) / tallest;
+        if (barHeight <= 0) { continue; }
+
+        const int barX = x + OVERLAY_PADDING + (i * BAR_WIDTH);
+        renderer.render_rectangle(barX, barBottom - barHeight, BAR_WIDTH - 1, barHeight, OVERLAY_BAR);
+    }
+}
+
+bool sdl2::FrameProfiler::write_csv(std::string_view filePath) const
+{
+    std::ofstream csvFile{filePath.data()};
+    if (!csvFile.is_open()) { return false; }
+
+    csvFile << std::format("# time_to_first_frame_ms,{:.3f}\n", m_timeToFirstFrame);
+    csvFile << "frame,update_ms,render_ms,present_ms,frame_ms\n";
+
+    // Oldest first. Once the ring buffer wraps, the oldest frame is the one about to be overwritten.
+    const size_t historySize  = FrameProfiler::get_history_size();
+    const uint64_t firstFrame = m_frameCount - historySize;
+    for (uint64_t frame = firstFrame; frame < m_frameCount; frame++)
+    {
+        const FrameProfiler::FrameTiming &timing = m_history[frame % HISTORY_LENGTH];
+        csvFile << std::format("{},{:.3f},{:.3f},{:.3f},{:.3f}\n",
+                               frame,
+                               timing.update,
+                               timing.render,
+                               timing.present,
+                               timing.frame);
+    }
+
+    return csvFile.good();
+}
+
+//                      ---- Private Functions ----
+
+size_t sdl2::FrameProfiler::get_history_size() const noexcept
+{ return std::min<uint64_t>(m_frameCount, HISTORY_LENGTH); }
+
+float sdl2::FrameProfiler::to_milliseconds(uint64_t ticks) noexcept
+{
+    static const double TICKS_PER_MILLISECOND = SDL_GetPerformanceFrequency() / 1000.0;
+    return ticks / TICKS_PER_MILLISECOND;
+}
+
+float sdl2::FrameProfiler::get_phase(const FrameProfiler::FrameTiming &timing, FrameProfiler::Phase phase) noexcept
+{
+    switch (phase)
+    {
+        case FrameProfiler::Phase::Update:  return timing.update;
+        case FrameProfiler::Phase::Render:  return timing.render;
+        case FrameProfiler::Phase::Present: return timing.present;
+        case FrameProfiler::Phase::Frame:   return timing.frame;
+    }
+
+    return 0.0f;
+}
\ No newline at end of file
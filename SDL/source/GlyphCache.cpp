@@ -0,0 +1,62 @@
+#include "GlyphCache.hpp"
+
+#include <bit>
+
+//                      ---- Public Functions ----
+
+const sdl2::GlyphData &sdl2::GlyphCache::insert(uint32_t codepoint, const sdl2::GlyphData &glyph)
+{
+    if (codepoint < DENSE_SIZE)
+    {
+        m_dense[codepoint] = glyph;
+        m_denseLoaded.set(codepoint);
+        return m_dense[codepoint];
+    }
+
+    // The table is kept at most half full so probes stay short.
+    if ((m_slotCount + 1) * 2 > m_slots.size()) { GlyphCache::grow(); }
+
+    size_t index = GlyphCache::get_home(codepoint);
+    while (m_slots[index].codepoint != EMPTY_CODEPOINT && m_slots[index].codepoint != codepoint)
+    {
+        index = (index + 1) & m_slotMask;
+    }
+
+    GlyphCache::Slot &slot = m_slots[index];
+    if (slot.codepoint == EMPTY_CODEPOINT) { ++m_slotCount; }
+
+    slot.codepoint = codepoint;
+    slot.glyph     = glyph;
+    return slot.glyph;
+}
+
+size_t sdl2::GlyphCache::get_size() const noexcept { return m_denseLoaded.count() + m_slotCount; }
+
+void sdl2::GlyphCache::clear()
+{
+    m_denseLoaded.reset();
+    m_slots.clear();
+    m_slotMask  = 0;
+    m_slotShift = 0;
+    m_slotCount = 0;
+}
+
+//                      ---- Private Functions ----
+
+void sdl2::GlyphCache::grow()
+{
+    std::vector<GlyphCache::Slot> oldSlots = std::move(m_slots);
+
+    const size_t slotCount = oldSlots.empty() ? INITIAL_SLOTS : oldSlots.size() * 2;
+    m_slots.assign(slotCount, GlyphCache::Slot{});
+    m_slotMask  = slotCount - 1;
+    m_slotShift = 32 - std::countr_zero(slotCount);
+    m_slotCount = 0;
+
+    for (const GlyphCache::Slot &slot : oldSlots)
+    {
+        if (slot.codepoint == EMPTY_CODEPOINT) { continue; }
+
+        GlyphCache::insert(slot.codepoint, slot.glyph);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,227 @@
+#include "GlyphRasterizer.hpp"
+
+#include "Freetype.hpp"
+
+//                      ---- Construction ----
+
+sdl2::GlyphRasterizer::~GlyphRasterizer()
+{
+    if (m_workers.empty()) { return; }
+
+    {
+        std::lock_guard<std::mutex> queueGuard{m_queueLock};
+        m_exitWorker = true;
+    }
+    m_queueCondition.notify_all();
+
+    for (std::thread &worker : m_workers) { worker.join(); }
+}
+
+//                      ---- Public Functions ----
+
+void sdl2::GlyphRasterizer::queue(const std::shared_ptr<sdl2::GlyphSet> &glyphSet, std::span<const uint32_t> codepoints)
+{
+    if (!glyphSet || !glyphSet->is_initialized()) { return; }
+
+    // Cached and already queued codepoints are skipped.
+    const std::vector<uint32_t> claimed = glyphSet->claim_pending(codepoints);
+    if (claimed.empty()) { return; }
+
+    GlyphRasterizer &instance = GlyphRasterizer::get_instance();
+    {
+        std::lock_guard<std::mutex> queueGuard{instance.m_queueLock};
+        for (size_t i = 0; i < claimed.size(); i += GLYPHS_PER_JOB)
+        {
+            const size_t jobSize = std::min(GLYPHS_PER_JOB, claimed.size() - i);
+            const std::span<const uint32_t> jobPoints{claimed.data() + i, jobSize};
+
+            instance.m_rasterQueue.push_back({.glyphSet = glyphSet, .codepoints = {jobPoints.begin(), jobPoints.end()}});
+            ++instance.m_pendingCount;
+        }
+    }
+    instance.m_queueCondition.notify_all();
+
+    // Workers are started the first time they're needed.
+    for (size_t i = instance.m_workers.size(); i < instance.m_workerCount; i++)
+    {
+        instance.m_workers.emplace_back(&GlyphRasterizer::worker_main, &instance);
+    }
+}
+
+size_t sdl2::GlyphRasterizer::get_pending_count() { return GlyphRasterizer::get_instance().m_pendingCount; }
+
+void sdl2::GlyphRasterizer::set_upload_budget(size_t bytes) { GlyphRasterizer::get_instance().m_uploadBudget = bytes; }
+
+void sdl2::GlyphRasterizer::set_worker_count(size_t count)
+{
+    GlyphRasterizer &instance = GlyphRasterizer::get_instance();
+    if (!instance.m_workers.empty() || count == 0) { return; }
+
+    instance.m_workerCount = count;
+}
+
+void sdl2::GlyphRasterizer::process_uploads()
+{
+    GlyphRasterizer &instance = GlyphRasterizer::get_instance();
+    instance.upload(instance.m_uploadBudget);
+}
+
+void sdl2::GlyphRasterizer::finish_pending()
+{
+    GlyphRasterizer &instance = GlyphRasterizer::get_instance();
+    while (instance.m_pendingCount > 0)
+    {
+        {
+            std::unique_lock<std::mutex> queueLock{instance.m_queueLock};
+            instance.m_uploadCondition.wait(queueLock, [&]() { return !instance.m_uploadQueue.empty(); });
+        }
+
+        instance.upload(SIZE_MAX);
+    }
+}
+
+//                      ---- Private Functions ----
+
+sdl2::GlyphRasterizer &sdl2::GlyphRasterizer::get_instance()
+{
+    static GlyphRasterizer instance;
+    return instance;
+}
+
+void sdl2::GlyphRasterizer::upload(size_t budget)
+{
+    if (m_pendingCount == 0) { return; }
+
+    size_t uploaded{};
+    while (uploaded < budget)
+    {
+        GlyphRasterizer::RasterizedBatch batch{};
+        {
+            std::lock_guard<std::mutex> queueGuard{m_queueLock};
+            if (m_uploadQueue.empty()) { return; }
+
+            batch = std::move(m_uploadQueue.front());
+            m_uploadQueue.pop_front();
+        }
+        --m_pendingCount;
+
+        // The whole batch goes in at once, so text never shows half of a job's glyphs for longer than a frame.
+        for (GlyphRasterizer::RasterizedGlyph &glyph : batch.glyphs)
+        {
+            if (glyph.surface) { uploaded += glyph.surface->pitch * glyph.surface->h; }
+
+            batch.glyphSet->insert_rasterized(glyph.codepoint, glyph.glyphData, glyph.surface);
+        }
+    }
+}
+
+void sdl2::GlyphRasterizer::worker_main()
+{
+    // FreeType libraries and faces can't be used by more than one thread, so each worker gets its own. Faces are kept
+    // between jobs so large faces aren't parsed again for every job.
+    sdl2::Freetype freetype{};
+    std::vector<GlyphRasterizer::WorkerFace> faces{};
+
+    for (;;)
+    {
+        GlyphRasterizer::RasterJob job{};
+        {
+            std::unique_lock<std::mutex> queueLock{m_queueLock};
+            m_queueCondition.wait(queueLock, [this]() { return m_exitWorker || !m_rasterQueue.empty(); });
+            if (m_exitWorker) { break; }
+
+            job = std::move(m_rasterQueue.front());
+            m_rasterQueue.pop_front();
+        }
+
+        // The set is handed back with the batch so it's always released on the render thread.
+        GlyphRasterizer::free_expired_faces(faces);
+        GlyphRasterizer::RasterizedBatch batch = GlyphRasterizer::rasterize_job(freetype.m_library, faces, job);
+        {
+            std::lock_guard<std::mutex> queueGuard{m_queueLock};
+            m_uploadQueue.push_back(std::move(batch));
+        }
+        m_uploadCondition.notify_one();
+    }
+
+    // Faces need to be freed before the library they belong to.
+    for (const GlyphRasterizer::WorkerFace &workerFace : faces) { FT_Done_Face(workerFace.face); }
+}
+
+sdl2::GlyphRasterizer::RasterizedBatch sdl2::GlyphRasterizer::rasterize_job(FT_Library library,
+                                                                            std::vector<GlyphRasterizer::WorkerFace> &faces,
+                                                                            GlyphRasterizer::RasterJob &job)
+{
+    // Glyphs that can't be rendered are cached as missing so they aren't queued again.
+    static constexpr sdl2::GlyphData MISSING_GLYPH = {.page = sdl2::GlyphData::MISSING_PAGE};
+
+    const std::span<const std::shared_ptr<sdl2::FontFace>> setFaces = job.glyphSet->get_faces();
+    const int pixelSize                                              = job.glyphSet->get_pixel_size();
+
+    GlyphRasterizer::RasterizedBatch batch{};
+    batch.glyphs.reserve(job.codepoints.size());
+    for (const uint32_t codepoint : job.codepoints)
+    {
+        GlyphRasterizer::RasterizedGlyph &glyph = batch.glyphs.emplace_back();
+        glyph.codepoint                         = codepoint;
+        glyph.glyphData                         = MISSING_GLYPH;
+
+        // Faces are only created for the faces codepoints actually need.
+        const std::optional<size_t> faceIndex = job.glyphSet->find_face(codepoint);
+        FT_Face face{};
+        if (faceIndex.has_value())
+        {
+            face = GlyphRasterizer::find_create_face(library, faces, setFaces[*faceIndex], pixelSize);
+        }
+
+        const FT_UInt charIndex = face ? FT_Get_Char_Index(face, codepoint) : 0;
+        if (charIndex == 0 || FT_Load_Glyph(face, charIndex, FT_LOAD_RENDER) != 0) { continue; }
+
+        sdl2::GlyphData glyphData{};
+        if (!sdl2::GlyphSet::rasterize(face->glyph, glyphData, glyph.surface)) { continue; }
+
+        glyph.glyphData = glyphData;
+    }
+
+    batch.glyphSet = std::move(job.glyphSet);
+    return batch;
+}
+
+FT_Face sdl2::GlyphRasterizer::find_create_face(FT_Library library,
+                                                std::vector<GlyphRasterizer::WorkerFace> &faces,
+                                                const std::shared_ptr<sdl2::FontFace> &source,
+                                                int pixelSize)
+{
+    // Comparing owners instead of addresses means a new FontFace at a freed one's address is never mistaken for it.
+    for (const GlyphRasterizer::WorkerFace &workerFace : faces)
+    {
+        const bool sameSource = !workerFace.source.owner_before(source) && !source.owner_before(workerFace.source);
+        if (sameSource && workerFace.pixelSize == pixelSize) { return workerFace.face; }
+    }
+
+    const std::span<const std::byte> fontData = source->get_data();
+    const FT_Byte *data                       = reinterpret_cast<const FT_Byte *>(fontData.data());
+    FT_Face face{};
+    if (!library || FT_New_Memory_Face(library, data, fontData.size(), 0, &face) != 0) { return nullptr; }
+
+    if (FT_Set_Pixel_Sizes(face, 0, pixelSize) != 0)
+    {
+        FT_Done_Face(face);
+        return nullptr;
+    }
+
+    faces.push_back({.source = source, .pixelSize = pixelSize, .face = face});
+    return face;
+}
+
+void sdl2::GlyphRasterizer::free_expired_faces(std::vector<GlyphRasterizer::WorkerFace> &faces)
+{
+    std::erase_if(faces,
+                  [](const GlyphRasterizer::WorkerFace &workerFace)
+                  {
+                      if (!workerFace.source.expired()) { return false; }
+
+                      FT_Done_Face(workerFace.face);
+                      return true;
+                  });
+}
\ No newline at end of file
@@ -0,0 +1,245 @@
+#include "GlyphSet.hpp"
+
+#include "RenderCounters.hpp"
+
+#include <algorithm>
+#include <mutex>
+#include <ft2build.h>
+#include FT_SIZES_H
+
+//                      ---- Construction ----
+
+sdl2::GlyphSet::GlyphSet(std::span<const std::shared_ptr<sdl2::FontFace>> faces, int pixelSize)
+    : m_pixelSize{pixelSize}
+{
+    for (const std::shared_ptr<sdl2::FontFace> &face : faces)
+    {
+        if (!face || !face->is_initialized()) { continue; }
+
+        // Each set gets its own size on the face, so setting this one doesn't affect sets of other sizes. Other threads
+        // might be drawing from the face right now.
+        std::lock_guard<std::mutex> faceGuard{face->get_lock()};
+        FT_Size faceSize{};
+        if (FT_New_Size(face->get(), &faceSize) != 0) { continue; }
+
+        const bool activated = FT_Activate_Size(faceSize) == 0;
+        const bool sized     = activated && FT_Set_Pixel_Sizes(face->get(), 0, m_pixelSize) == 0;
+        if (!sized)
+        {
+            FT_Done_Size(faceSize);
+            continue;
+        }
+
+        m_faces.push_back(face);
+        m_sizes.push_back(faceSize);
+    }
+
+    GlyphSet::build_coverage();
+    m_isInitialized = !m_faces.empty();
+}
+
+sdl2::GlyphSet::~GlyphSet()
+{
+    // The last font using the set can be freed on any thread, while other sets still draw from the faces.
+    for (size_t i = 0; i < m_sizes.size(); i++)
+    {
+        std::lock_guard<std::mutex> faceGuard{m_faces[i]->get_lock()};
+        FT_Done_Size(m_sizes[i]);
+    }
+}
+
+//                      ---- Public Functions ----
+
+const std::shared_ptr<sdl2::Texture> &sdl2::GlyphSet::get_page(int page) const noexcept
+{
+    return m_glyphAtlas.get_page(page);
+}
+
+int sdl2::GlyphSet::get_pixel_size() const noexcept { return m_pixelSize; }
+
+size_t sdl2::GlyphSet::get_glyph_byte_size() const noexcept
+{
+    constexpr size_t PAGE_BYTES = static_cast<size_t>(GLYPH_PAGE_SIZE) * GLYPH_PAGE_SIZE * 4;
+    return m_glyphAtlas.get_page_count() * PAGE_BYTES;
+}
+
+std::vector<uint32_t> sdl2::GlyphSet::claim_pending(std::span<const uint32_t> codepoints)
+{
+    // Placeholder cached while the glyph is rasterized. Codepoints repeated in the span are only claimed once.
+    static constexpr sdl2::GlyphData PENDING_GLYPH = {.page = sdl2::GlyphData::PENDING_PAGE};
+
+    std::vector<uint32_t> claimed{};
+    for (const uint32_t codepoint : codepoints)
+    {
+        if (m_glyphCache.find(codepoint)) { continue; }
+
+        m_glyphCache.insert(codepoint, PENDING_GLYPH);
+        claimed.push_back(codepoint);
+    }
+
+    return claimed;
+}
+
+void sdl2::GlyphSet::insert_rasterized(uint32_t codepoint, sdl2::GlyphData glyphData, sdl2::Surface &surface)
+{
+    // A glyph that doesn't fit can't be retried, since it's already cached. It's treated like one no face has.
+    if (surface)
+    {
+        const auto region = m_glyphAtlas.pack(surface);
+        glyphData.page    = region.has_value() ? static_cast<int16_t>(region->page) : sdl2::GlyphData::MISSING_PAGE;
+        glyphData.source  = region.has_value() ? region->source : SDL_Rect{};
+    }
+    m_glyphCache.insert(codepoint, glyphData);
+
+    // Anything laid out while this was pending was laid out without it.
+    if (m_skippedPending)
+    {
+        ++m_generation;
+        m_skippedPending = false;
+    }
+}
+
+uint32_t sdl2::GlyphSet::get_generation() const noexcept { return m_generation; }
+
+std::span<const std::shared_ptr<sdl2::FontFace>> sdl2::GlyphSet::get_faces() const noexcept { return m_faces; }
+
+std::optional<size_t> sdl2::GlyphSet::find_face(uint32_t codepoint) const noexcept
+{
+    // Find the last range starting at or before the codepoint.
+    auto startsAfter = [](uint32_t point, const GlyphSet::FaceRange &range) { return point < range.first; };
+    auto findRange   = std::upper_bound(m_coverage.begin(), m_coverage.end(), codepoint, startsAfter);
+    if (findRange == m_coverage.begin()) { return std::nullopt; }
+
+    --findRange;
+    if (codepoint > findRange->last) { return std::nullopt; }
+
+    return findRange->face;
+}
+
+bool sdl2::GlyphSet::rasterize(const FT_GlyphSlot glyphSlot, sdl2::GlyphData &glyphData, sdl2::Surface &surface)
+{
+    // Base pixel color for constructing ARGB pixels. The glyph's coverage becomes the alpha.
+    static constexpr uint32_t BASE_PIXEL_COLOR = 0x00FFFFFF;
+
+    // This makes things easier to read later.
+    const FT_Bitmap &glyphBitmap = glyphSlot->bitmap;
+    const int bitmapWidth        = glyphBitmap.width;
+    const int bitmapHeight       = glyphBitmap.rows;
+
+    glyphData.advanceX = static_cast<int16_t>(glyphSlot->advance.x >> 6);
+    glyphData.top      = static_cast<int16_t>(glyphSlot->bitmap_top);
+    glyphData.left     = static_cast<int16_t>(glyphSlot->bitmap_left);
+
+    // Glyphs like spaces don't have anything to pack.
+    if (bitmapWidth <= 0 || bitmapHeight <= 0) { return true; }
+
+    // Surface to construct on. This is created in the atlas' format so it doesn't need to be converted.
+    surface.reset(SDL_CreateRGBSurfaceWithFormat(0, bitmapWidth, bitmapHeight, 32, SDL_PIXELFORMAT_ARGB8888));
+    if (!surface) { return false; }
+
+    // Loop and construct glyph. Both the surface and bitmap can have padding at the end of their rows.
+    for (int y = 0; y < bitmapHeight; y++)
+    {
+        uint8_t *surfaceRow      = reinterpret_cast<uint8_t *>(surface->pixels) + (y * surface->pitch);
+        const uint8_t *bitmapRow = glyphBitmap.buffer + (y * glyphBitmap.pitch);
+
+        std::span<uint32_t> surfacePixels{reinterpret_cast<uint32_t *>(surfaceRow), static_cast<size_t>(bitmapWidth)};
+        for (int x = 0; x < bitmapWidth; x++)
+        {
+            const uint32_t alpha = bitmapRow[x];
+            surfacePixels[x]     = BASE_PIXEL_COLOR | (alpha << 24);
+        }
+    }
+
+    return true;
+}
+
+//                      ---- Private Functions ----
+
+void sdl2::GlyphSet::build_coverage()
+{
+    // Every range start and end splits the codepoints into intervals that are covered by the same faces.
+    std::vector<uint32_t> bounds{};
+    for (const std::shared_ptr<sdl2::FontFace> &face : m_faces)
+    {
+        for (const sdl2::CoverageRange &range : face->get_coverage())
+        {
+            bounds.push_back(range.first);
+            bounds.push_back(range.last + 1);
+        }
+    }
+    std::sort(bounds.begin(), bounds.end());
+    bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+    // Intervals are visited in order, so each face's position in its ranges only moves forward.
+    const size_t faceCount = m_faces.size();
+    std::vector<size_t> cursors(faceCount);
+    for (size_t i = 0; i + 1 < bounds.size(); i++)
+    {
+        const uint32_t first = bounds[i];
+        const uint32_t last  = bounds[i + 1] - 1;
+        for (size_t face = 0; face < faceCount; face++)
+        {
+            const std::span<const sdl2::CoverageRange> ranges = m_faces[face]->get_coverage();
+
+            size_t &cursor = cursors[face];
+            while (cursor < ranges.size() && ranges[cursor].last < first) { ++cursor; }
+            if (cursor == ranges.size() || ranges[cursor].first > first) { continue; }
+
+            // Neighbouring intervals of the same face are merged to keep the index small.
+            const uint32_t faceIndex = static_cast<uint32_t>(face);
+            if (!m_coverage.empty() && m_coverage.back().face == faceIndex && m_coverage.back().last + 1 == first)
+            {
+                m_coverage.back().last = last;
+            }
+            else { m_coverage.push_back({.first = first, .last = last, .face = faceIndex}); }
+            break;
+        }
+    }
+}
+
+OptionalReference<const sdl2::GlyphData> sdl2::GlyphSet::load_glyph(uint32_t codepoint)
+{
+    // Codepoints no face has are remembered so they're never searched for again.
+    static constexpr sdl2::GlyphData MISSING_GLYPH = {.page = sdl2::GlyphData::MISSING_PAGE};
+
+    const std::optional<size_t> faceIndex = GlyphSet::find_face(codepoint);
+    const FT_Face face                    = faceIndex.has_value() ? m_faces[*faceIndex]->get() : nullptr;
+
+    // Other sets can create and free sizes on the face from other threads.
+    std::unique_lock<std::mutex> faceLock{};
+    if (face) { faceLock = std::unique_lock<std::mutex>{m_faces[*faceIndex]->get_lock()}; }
+
+    const FT_UInt charIndex = face ? FT_Get_Char_Index(face, codepoint) : 0;
+    if (charIndex == 0)
+    {
+        m_glyphCache.insert(codepoint, MISSING_GLYPH);
+        return std::nullopt;
+    }
+
+    // Faces are shared between sets, so this set's size needs to be activated before rendering.
+    const bool activated = FT_Activate_Size(m_sizes[*faceIndex]) == 0;
+    if (!activated || FT_Load_Glyph(face, charIndex, FT_LOAD_RENDER) != 0) { return std::nullopt; }
+
+    // Convert and pack into the atlas.
+    SDL2_COUNT(glyphCacheMisses);
+    sdl2::GlyphData glyphData{};
+    if (!GlyphSet::pack_glyph(face->glyph, glyphData)) { return std::nullopt; }
+
+    return m_glyphCache.insert(codepoint, glyphData);
+}
+
+bool sdl2::GlyphSet::pack_glyph(const FT_GlyphSlot glyphSlot, sdl2::GlyphData &glyphData)
+{
+    sdl2::Surface glyphSurface{nullptr, SDL_FreeSurface};
+    if (!GlyphSet::rasterize(glyphSlot, glyphData, glyphSurface)) { return false; }
+    else if (!glyphSurface) { return true; }
+
+    const auto region = m_glyphAtlas.pack(glyphSurface);
+    if (!region.has_value()) { return false; }
+
+    glyphData.page   = static_cast<int16_t>(region->page);
+    glyphData.source = region->source;
+
+    return true;
+}
\ No newline at end of file
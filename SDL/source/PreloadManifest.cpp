@@ -0,0 +1,55 @@
+#include "PreloadManifest.hpp"
+
+#include "TextureLoader.hpp"
+
+#include <fstream>
+#include <string>
+
+namespace
+{
+    /// @brief Separates the name and path on each line.
+    constexpr char MANIFEST_SEPARATOR = '\t';
+}
+
+//                      ---- Public Functions ----
+
+size_t sdl2::PreloadManifest::preload(std::string_view manifestPath)
+{
+    std::ifstream manifestFile{manifestPath.data()};
+    if (!manifestFile.is_open()) { return 0; }
+
+    size_t queued{};
+    std::string line{};
+    while (std::getline(manifestFile, line))
+    {
+        const size_t separator = line.find(MANIFEST_SEPARATOR);
+        if (separator == line.npos) { continue; }
+
+        const std::string_view lineView = line;
+        const std::string_view name     = lineView.substr(0, separator);
+        const std::string_view path     = lineView.substr(separator + 1);
+        m_textures.push_back(sdl2::TextureLoader::load_async(name, path));
+        ++queued;
+    }
+
+    return queued;
+}
+
+void sdl2::PreloadManifest::wait() { sdl2::TextureLoader::finish_pending(); }
+
+void sdl2::PreloadManifest::release() { m_textures.clear(); }
+
+bool sdl2::PreloadManifest::write(std::string_view manifestPath)
+{
+    std::ofstream manifestFile{manifestPath.data()};
+    if (!manifestFile.is_open()) { return false; }
+
+    for (const sdl2::ResourceRecord &record : sdl2::TextureManager::get_records())
+    {
+        if (record.path.empty()) { continue; }
+
+        manifestFile << record.name << MANIFEST_SEPARATOR << record.path << '\n';
+    }
+
+    return manifestFile.good();
+}
\ No newline at end of file
@@ -0,0 +1,181 @@
+#include "Qoi.hpp"
+
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+namespace
+{
+    /// @brief Magic every QOI file starts with.
+    constexpr std::array<uint8_t, 4> QOI_MAGIC = {'q', 'o', 'i', 'f'};
+
+    /// @brief Size of the header.
+    constexpr size_t QOI_HEADER_SIZE = 14;
+
+    /// @brief Size of the end marker. It's seven zeroes followed by a one.
+    constexpr size_t QOI_END_SIZE = 8;
+
+    /// @brief Largest image the reference implementation allows.
+    constexpr uint64_t QOI_PIXELS_MAX = 400000000;
+
+    /// @brief Two bit op tags.
+    constexpr uint8_t QOI_OP_INDEX = 0x00;
+    constexpr uint8_t QOI_OP_DIFF  = 0x40;
+    constexpr uint8_t QOI_OP_LUMA  = 0x80;
+    constexpr uint8_t QOI_OP_RUN   = 0xC0;
+    constexpr uint8_t QOI_MASK_2   = 0xC0;
+
+    /// @brief Eight bit op tags.
+    constexpr uint8_t QOI_OP_RGB  = 0xFE;
+    constexpr uint8_t QOI_OP_RGBA = 0xFF;
+
+    // clang-format off
+    /// @brief Pixel as it's decoded.
+    struct QoiPixel
+    {
+        uint8_t r{};
+        uint8_t g{};
+        uint8_t b{};
+        uint8_t a{};
+    };
+    // clang-format on
+
+    /// @brief Reads a big endian 32 bit integer.
+    inline uint32_t read_big_endian(const uint8_t *bytes) noexcept
+    {
+        return (bytes[0] << 24) | (bytes[1] << 16) | (bytes[2] << 8) | bytes[3];
+    }
+
+    /// @brief Returns the position of the pixel in the running index.
+    inline size_t index_position(const QoiPixel &pixel) noexcept
+    {
+        return (pixel.r * 3 + pixel.g * 5 + pixel.b * 7 + pixel.a * 11) % 64;
+    }
+
+    /// @brief Packs the pixel to ARGB8888.
+    inline uint32_t to_argb(const QoiPixel &pixel) noexcept
+    {
+        return (pixel.a << 24) | (pixel.r << 16) | (pixel.g << 8) | pixel.b;
+    }
+}
+
+bool sdl2::qoi::has_extension(std::string_view filePath) noexcept
+{
+    if (filePath.length() < EXTENSION.length()) { return false; }
+
+    // Extensions are compared case insensitively.
+    const std::string_view extension = filePath.substr(filePath.length() - EXTENSION.length());
+    for (size_t i = 0; i < EXTENSION.length(); i++)
+    {
+        const char lower = extension[i] >= 'A' && extension[i] <= 'Z' ? extension[i] + ('a' - 'A') : extension[i];
+        if (lower != EXTENSION[i]) { return false; }
+    }
+
+    return true;
+}
+
+bool sdl2::qoi::is_qoi(const void *data, size_t dataSize) noexcept
+{
+    if (!data || dataSize < QOI_HEADER_SIZE + QOI_END_SIZE) { return false; }
+
+    return std::memcmp(data, QOI_MAGIC.data(), QOI_MAGIC.size()) == 0;
+}
+
+SDL_Surface *sdl2::qoi::decode(const void *data, size_t dataSize)
+{
+    if (!sdl2::qoi::is_qoi(data, dataSize)) { return nullptr; }
+
+    const uint8_t *bytes   = static_cast<const uint8_t *>(data);
+    const uint32_t width   = read_big_endian(&bytes[4]);
+    const uint32_t height  = read_big_endian(&bytes[8]);
+    const uint8_t channels = bytes[12];
+    const bool validSize   = width > 0 && height > 0 && static_cast<uint64_t>(width) * height <= QOI_PIXELS_MAX;
+    if (!validSize || (channels != 3 && channels != 4)) { return nullptr; }
+
+    SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!surface) { return nullptr; }
+
+    std::array<QoiPixel, 64> index{};
+    QoiPixel pixel = {.r = 0x00, .g = 0x00, .b = 0x00, .a = 0xFF};
+    uint32_t argb  = to_argb(pixel);
+    int run{};
+
+    // The end marker is never part of a chunk. Every op reads at most five bytes, so only the last ones are checked.
+    const size_t chunksEnd = dataSize - QOI_END_SIZE;
+    size_t offset          = QOI_HEADER_SIZE;
+    for (uint32_t y = 0; y < height; y++)
+    {
+        uint32_t *row = reinterpret_cast<uint32_t *>(static_cast<uint8_t *>(surface->pixels) + (y * surface->pitch));
+        for (uint32_t x = 0; x < width; x++)
+        {
+            if (run > 0)
+            {
+                --run;
+                row[x] = argb;
+                continue;
+            }
+
+            if (offset >= chunksEnd)
+            {
+                SDL_FreeSurface(surface);
+                return nullptr;
+            }
+
+            const uint8_t op = bytes[offset++];
+            if (op == QOI_OP_RGB)
+            {
+                pixel.r = bytes[offset];
+                pixel.g = bytes[offset + 1];
+                pixel.b = bytes[offset + 2];
+                offset += 3;
+            }
+            else if (op == QOI_OP_RGBA)
+            {
+                pixel.r = bytes[offset];
+                pixel.g = bytes[offset + 1];
+                pixel.b = bytes[offset + 2];
+                pixel.a = bytes[offset + 3];
+                offset += 4;
+            }
+            else if ((op & QOI_MASK_2) == QOI_OP_INDEX) { pixel = index[op]; }
+            else if ((op & QOI_MASK_2) == QOI_OP_DIFF)
+            {
+                pixel.r += ((op >> 4) & 0x03) - 2;
+                pixel.g += ((op >> 2) & 0x03) - 2;
+                pixel.b += (op & 0x03) - 2;
+            }
+            else if ((op & QOI_MASK_2) == QOI_OP_LUMA)
+            {
+                const uint8_t second = bytes[offset++];
+                const int greenDiff  = (op & 0x3F) - 32;
+                pixel.r += greenDiff - 8 + ((second >> 4) & 0x0F);
+                pixel.g += greenDiff;
+                pixel.b += greenDiff - 8 + (second & 0x0F);
+            }
+            else { run = op & 0x3F; } // QOI_OP_RUN. The current pixel is the first of the run.
+
+            index[index_position(pixel)] = pixel;
+            argb                         = to_argb(pixel);
+            row[x]                       = argb;
+        }
+    }
+
+    return surface;
+}
+
+SDL_Surface *sdl2::qoi::load(std::string_view filePath)
+{
+    std::ifstream qoiFile{filePath.data(), std::ios::binary | std::ios::ate};
+    if (!qoiFile.is_open()) { return nullptr; }
+
+    const std::streamsize fileSize = qoiFile.tellg();
+    if (fileSize <= 0) { return nullptr; }
+
+    std::vector<uint8_t> fileData(fileSize);
+    qoiFile.seekg(0);
+    if (!qoiFile.read(reinterpret_cast<char *>(fileData.data()), fileSize)) { return nullptr; }
+
+    return sdl2::qoi::decode(fileData.data(), fileData.size());
+}
\ No newline at end of file
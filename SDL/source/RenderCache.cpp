@@ -0,0 +1,61 @@
+#include "RenderCache.hpp"
+
+namespace
+{
+    /// @brief Color the target is cleared to before redrawing.
+    constexpr SDL_Color CLEAR_COLOR = {.r = 0x00, .g = 0x00, .b = 0x00, .a = 0x00};
+}
+
+//                      ---- Construction ----
+
+sdl2::RenderCache::RenderCache(int width, int height)
+    : m_width{width}
+    , m_height{height} {}
+
+//                      ---- Public Functions ----
+
+void sdl2::RenderCache::invalidate() noexcept { m_isValid = false; }
+
+bool sdl2::RenderCache::is_valid() const noexcept { return m_isValid; }
+
+int sdl2::RenderCache::get_width() const noexcept { return m_width; }
+
+int sdl2::RenderCache::get_height() const noexcept { return m_height; }
+
+//                      ---- Private Functions ----
+
+bool sdl2::RenderCache::begin_redraw(sdl2::Renderer &renderer)
+{
+    if (!m_target)
+    {
+        m_target = std::make_shared<sdl2::Texture>(m_width, m_height, SDL_TEXTUREACCESS_TARGET);
+        if (!m_target->is_initialized())
+        {
+            m_target.reset();
+            return false;
+        }
+
+        // Content blended onto a transparent target ends up premultiplied. Blending it normally again would darken the
+        // edges, so the target is drawn with a premultiplied blend instead.
+        m_target->set_blend_mode(sdl2::Texture::get_premultiplied_blend_mode());
+    }
+
+    if (!renderer.push_render_target(m_target)) { return false; }
+
+    // The caller doesn't call end_redraw when this fails, so the target can't be left pushed.
+    if (!renderer.clear(CLEAR_COLOR))
+    {
+        renderer.pop_render_target();
+        return false;
+    }
+
+    return true;
+}
+
+bool sdl2::RenderCache::end_redraw(sdl2::Renderer &renderer)
+{
+    if (!renderer.pop_render_target()) { return false; }
+
+    m_isValid = true;
+    return true;
+}
\ No newline at end of file
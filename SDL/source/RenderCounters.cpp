@@ -0,0 +1,62 @@
+#include "RenderCounters.hpp"
+
+sdl2::FrameCounters sdl2::RenderCounters::sm_currentFrame{};
+sdl2::FrameCounters sdl2::RenderCounters::sm_lastFrame{};
+std::array<std::atomic<uint32_t>, static_cast<size_t>(sdl2::RenderCounters::Resource::Count)>
+    sdl2::RenderCounters::sm_resourceCounts{};
+const void *sdl2::RenderCounters::sm_lastTexture{};
+std::unordered_set<const void *> sdl2::RenderCounters::sm_frameTextures{};
+
+//                      ---- Public Functions ----
+
+sdl2::FrameCounters sdl2::RenderCounters::get_last_frame() noexcept { return sm_lastFrame; }
+
+bool sdl2::RenderCounters::is_enabled() noexcept
+{
+#ifdef SDL2_COUNTERS_ENABLED
+    return true;
+#else
+    return false;
+#endif
+}
+
+void sdl2::RenderCounters::end_frame() noexcept
+{
+#ifdef SDL2_COUNTERS_ENABLED
+    // Resource counts can come in from any thread, so they're swapped out instead of copied and cleared.
+    auto takeCount = [](RenderCounters::Resource counter)
+    { return sm_resourceCounts[static_cast<size_t>(counter)].exchange(0, std::memory_order_relaxed); };
+
+    sm_lastFrame                  = sm_currentFrame;
+    sm_lastFrame.resourcesCreated = takeCount(RenderCounters::Resource::Created);
+    sm_lastFrame.resourcesPurged  = takeCount(RenderCounters::Resource::Purged);
+    sm_currentFrame               = {};
+
+    sm_lastTexture = nullptr;
+    sm_frameTextures.clear();
+#endif
+}
+
+void sdl2::RenderCounters::count([[maybe_unused]] uint32_t sdl2::FrameCounters::*counter) noexcept
+{
+#ifdef SDL2_COUNTERS_ENABLED
+    ++(sm_currentFrame.*counter);
+#endif
+}
+
+void sdl2::RenderCounters::count_resource([[maybe_unused]] RenderCounters::Resource counter) noexcept
+{
+#ifdef SDL2_COUNTERS_ENABLED
+    sm_resourceCounts[static_cast<size_t>(counter)].fetch_add(1, std::memory_order_relaxed);
+#endif
+}
+
+void sdl2::RenderCounters::bind_texture([[maybe_unused]] const void *texture)
+{
+#ifdef SDL2_COUNTERS_ENABLED
+    if (texture != sm_lastTexture) { ++sm_currentFrame.textureSwitches; }
+    if (sm_frameTextures.insert(texture).second) { ++sm_currentFrame.distinctTextures; }
+
+    sm_lastTexture = texture;
+#endif
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#include "RenderTargetPool.hpp"
+
+#include "Texture.hpp"
+
+namespace
+{
+    /// @brief Color mod targets are reset to.
+    constexpr SDL_Color NO_COLOR_MOD = {.r = 0xFF, .g = 0xFF, .b = 0xFF, .a = 0xFF};
+}
+
+//                      ---- Public Functions ----
+
+std::shared_ptr<sdl2::Texture> sdl2::RenderTargetPool::acquire(int width, int height, uint32_t format)
+{
+    for (RenderTargetPool::PooledTarget &pooled : m_targets)
+    {
+        // Only the pool referencing it means nobody else is using it.
+        const bool matches = pooled.width == width && pooled.height == height && pooled.format == format;
+        if (!matches || pooled.texture.use_count() > 1) { continue; }
+
+        pooled.texture->set_color_mod(NO_COLOR_MOD);
+        pooled.texture->set_blend_mode(sdl2::Texture::get_premultiplied_blend_mode());
+        return pooled.texture;
+    }
+
+    // Targets are drawn into after being cleared to transparent, so what ends up on them is premultiplied.
+    auto texture = std::make_shared<sdl2::Texture>(width, height, SDL_TEXTUREACCESS_TARGET, format);
+    if (!texture->is_initialized()) { return nullptr; }
+
+    texture->set_blend_mode(sdl2::Texture::get_premultiplied_blend_mode());
+
+    m_targets.push_back({.width = width, .height = height, .format = format, .texture = texture});
+    return texture;
+}
+
+void sdl2::RenderTargetPool::trim()
+{
+    std::erase_if(m_targets, [](const RenderTargetPool::PooledTarget &pooled) { return pooled.texture.use_count() <= 1; });
+}
+
+void sdl2::RenderTargetPool::clear() { m_targets.clear(); }
+
+size_t sdl2::RenderTargetPool::get_size() const noexcept { return m_targets.size(); }
\ No newline at end of file
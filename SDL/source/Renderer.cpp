@@ -1,6 +1,11 @@
 #include "Renderer.hpp"
 
+#include "GlyphRasterizer.hpp"
+#include "RenderCounters.hpp"
+#include "ResourceManager.hpp"
 #include "Texture.hpp"
+#include "TextureLoader.hpp"
+#include "color_compare.hpp"
 
 #include <cstdint>
 
@@ -8,6 +13,20 @@ namespace
 {
     /// @brief Flags used for creating the renderer.
     constexpr uint32_t SDL_RENDER_FLAGS = SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC;
+
+    /// @brief Clip rectangle that means clipping is disabled.
+    constexpr SDL_Rect NO_CLIP = {.x = 0, .y = 0, .w = 0, .h = 0};
+
+    /// @brief Returns whether or not the clip rectangles passed are the same.
+    inline bool same_clip(const SDL_Rect &rectA, const SDL_Rect &rectB) noexcept
+    {
+        // SDL treats every empty rectangle as disabled clipping.
+        const bool emptyA = rectA.w <= 0 || rectA.h <= 0;
+        const bool emptyB = rectB.w <= 0 || rectB.h <= 0;
+        if (emptyA || emptyB) { return emptyA == emptyB; }
+
+        return rectA.x == rectB.x && rectA.y == rectB.y && rectA.w == rectB.w && rectA.h == rectB.h;
+    }
 }
 
 //                      ---- Construction ----
@@ -18,6 +37,16 @@ sdl2::Renderer::~Renderer()
 {
     if (!m_renderer) { return; }
 
+    // Anything still batched is submitted while its textures and the renderer still exist.
+    Renderer::flush_batch();
+
+    // Targets need to be destroyed while the renderer still exists.
+    m_targetStack = {};
+    m_targetPool.clear();
+
+    // Textures outliving the renderer, like those held by statics, must not reach back into it when they're freed.
+    if (sdl2::Texture::sm_renderer == this) { sdl2::Texture::sm_renderer = nullptr; }
+
     SDL_DestroyRenderer(m_renderer);
 }
 
@@ -28,55 +57,303 @@ void sdl2::Renderer::create(sdl2::Window &window)
     m_renderer = SDL_CreateRenderer(window.m_window, -1, SDL_RENDER_FLAGS);
     if (!m_renderer) { return; }
 
-    const bool blendMode = SDL_SetRenderDrawBlendMode(m_renderer, SDL_BLENDMODE_BLEND) == 0;
+    const bool blendMode = Renderer::set_draw_blend_mode(SDL_BLENDMODE_BLEND);
     if (!blendMode) { return; }
 
+    Renderer::update_visible_rect();
     m_isInitialized = true;
 }
 
 bool sdl2::Renderer::set_logical_presentation(int width, int height)
-{ return SDL_RenderSetLogicalSize(m_renderer, width, height) == 0; }
+{
+    // Anything queued needs to go out under the old presentation.
+    Renderer::flush_batch();
+
+    if (SDL_RenderSetLogicalSize(m_renderer, width, height) != 0) { return false; }
+
+    m_logicalWidth  = width;
+    m_logicalHeight = height;
+    Renderer::update_visible_rect();
+    return true;
+}
+
+int sdl2::Renderer::get_logical_width() const noexcept { return m_logicalWidth; }
+
+int sdl2::Renderer::get_logical_height() const noexcept { return m_logicalHeight; }
 
 bool sdl2::Renderer::set_render_clip(int x, int y, int width, int height)
 {
     const SDL_Rect clipRect = {.x = x, .y = y, .w = width, .h = height};
-    return SDL_RenderSetClipRect(m_renderer, &clipRect) == 0;
+    if (m_clipRect.has_value() && same_clip(*m_clipRect, clipRect))
+    {
+        ++m_skippedStateChanges;
+        return true;
+    }
+
+    Renderer::flush_batch();
+
+    const bool clipSet = SDL_RenderSetClipRect(m_renderer, &clipRect) == 0;
+    m_clipRect         = clipSet ? std::optional<SDL_Rect>{clipRect} : std::nullopt;
+    Renderer::update_visible_rect();
+
+    return clipSet;
+}
+
+bool sdl2::Renderer::disable_render_clip()
+{
+    if (m_clipRect.has_value() && same_clip(*m_clipRect, NO_CLIP))
+    {
+        ++m_skippedStateChanges;
+        return true;
+    }
+
+    Renderer::flush_batch();
+
+    const bool clipSet = SDL_RenderSetClipRect(m_renderer, nullptr) == 0;
+    m_clipRect         = clipSet ? std::optional<SDL_Rect>{NO_CLIP} : std::nullopt;
+    Renderer::update_visible_rect();
+
+    return clipSet;
 }
 
 bool sdl2::Renderer::set_render_target(std::shared_ptr<sdl2::Texture> target)
-{ return SDL_SetRenderTarget(m_renderer, target->m_texture) == 0; }
+{
+    SDL_Texture *targetTexture = target->m_texture;
+    if (targetTexture == m_currentTarget)
+    {
+        ++m_skippedStateChanges;
+        return true;
+    }
+
+    Renderer::flush_batch();
+
+    const bool targetSet = SDL_SetRenderTarget(m_renderer, targetTexture) == 0;
+    if (targetSet)
+    {
+        m_currentTarget = targetTexture;
+        m_targetWidth   = target->m_width;
+        m_targetHeight  = target->m_height;
+        SDL2_COUNT(targetSwitches);
+    }
+
+    // SDL swaps the clip rectangle out with the target.
+    m_clipRect.reset();
+    Renderer::update_visible_rect();
+
+    return targetSet;
+}
+
+bool sdl2::Renderer::push_render_target(std::shared_ptr<sdl2::Texture> target)
+{
+    // Save this before switching. Switching targets resets the clip shadow.
+    Renderer::TargetState state = {.target        = target,
+                                   .clipRect      = m_clipRect,
+                                   .logicalWidth  = m_logicalWidth,
+                                   .logicalHeight = m_logicalHeight};
+
+    if (!Renderer::set_render_target(std::move(target))) { return false; }
+
+    m_targetStack.push(std::move(state));
+    return true;
+}
+
+bool sdl2::Renderer::pop_render_target()
+{
+    if (m_targetStack.empty()) { return false; }
+
+    const Renderer::TargetState state = std::move(m_targetStack.top());
+    m_targetStack.pop();
+
+    // Resume rendering to the previous target or the frame buffer if there isn't one.
+    const auto &previous = m_targetStack.empty() ? sdl2::Texture::null : m_targetStack.top().target;
+    if (!Renderer::set_render_target(previous)) { return false; }
+
+    // Restore whatever was set before the push.
+    const bool logicalChanged = m_logicalWidth != state.logicalWidth || m_logicalHeight != state.logicalHeight;
+    if (logicalChanged && !Renderer::set_logical_presentation(state.logicalWidth, state.logicalHeight)) { return false; }
+
+    if (!state.clipRect.has_value()) { return true; }
+
+    const SDL_Rect &clip = *state.clipRect;
+    if (same_clip(clip, NO_CLIP)) { return Renderer::disable_render_clip(); }
+
+    return Renderer::set_render_clip(clip.x, clip.y, clip.w, clip.h);
+}
+
+sdl2::RenderTargetPool &sdl2::Renderer::get_target_pool() noexcept { return m_targetPool; }
+
+bool sdl2::Renderer::clear(SDL_Color color)
+{
+    Renderer::flush_batch();
+
+    if (!Renderer::set_draw_color(color)) { return false; }
+
+    return SDL_RenderClear(m_renderer) == 0;
+}
 
 bool sdl2::Renderer::set_draw_color(SDL_Color color)
-{ return SDL_SetRenderDrawColor(m_renderer, color.r, color.g, color.b, color.a) == 0; }
+{
+    if (m_drawColor.has_value() && *m_drawColor == color)
+    {
+        ++m_skippedStateChanges;
+        return true;
+    }
+
+    const bool colorSet = SDL_SetRenderDrawColor(m_renderer, color.r, color.g, color.b, color.a) == 0;
+    m_drawColor         = colorSet ? std::optional<SDL_Color>{color} : std::nullopt;
+
+    return colorSet;
+}
+
+bool sdl2::Renderer::set_draw_blend_mode(SDL_BlendMode mode)
+{
+    if (m_drawBlendMode.has_value() && *m_drawBlendMode == mode)
+    {
+        ++m_skippedStateChanges;
+        return true;
+    }
+
+    const bool modeSet = SDL_SetRenderDrawBlendMode(m_renderer, mode) == 0;
+    m_drawBlendMode    = modeSet ? std::optional<SDL_BlendMode>{mode} : std::nullopt;
+
+    return modeSet;
+}
+
+uint64_t sdl2::Renderer::get_skipped_state_changes() const noexcept { return m_skippedStateChanges; }
+
+std::optional<SDL_Rect> sdl2::Renderer::get_visible_rect() const noexcept { return m_visibleRect; }
+
+bool sdl2::Renderer::is_visible(const SDL_Rect &rect) const noexcept
+{
+    if (!m_visibleRect.has_value()) { return true; }
+
+    return SDL_HasIntersection(&rect, &*m_visibleRect) == SDL_TRUE;
+}
+
+uint64_t sdl2::Renderer::get_culled_draws() const noexcept { return m_culledDraws; }
+
+void sdl2::Renderer::set_batching(bool enabled)
+{
+    // Submit whatever was queued before switching modes.
+    if (!enabled) { Renderer::flush_batch(); }
+
+    m_batching = enabled;
+}
+
+bool sdl2::Renderer::is_batching() const noexcept { return m_batching; }
+
+bool sdl2::Renderer::flush_batch() { return m_spriteBatch.flush(m_renderer); }
 
 bool sdl2::Renderer::frame_begin(SDL_Color clearColor)
 {
+    // Everything since the last present was the update.
+    m_frameProfiler.frame_begin();
+    sdl2::RenderCounters::end_frame();
+
+    // Background loads land at the start of the frame so they're usable during it.
+    sdl2::TextureLoader::process_uploads();
+    sdl2::GlyphRasterizer::process_uploads();
+
+    // Caches that grew since the last frame are evicted here. Resources only change on this thread.
+    sdl2::TextureManager::evict_pending();
+    sdl2::FontManager::evict_pending();
+    sdl2::SoundManager::evict_pending();
+
     // Start by clearing.
-    // Set the draw color.
-    int sdlError = SDL_SetRenderDrawColor(m_renderer, clearColor.r, clearColor.g, clearColor.b, clearColor.a);
-    if (sdlError != 0) { return false; }
+    return Renderer::clear(clearColor);
+}
 
-    // Clear the renderer.
-    sdlError = SDL_RenderClear(m_renderer);
-    if (sdlError != 0) { return false; }
+void sdl2::Renderer::frame_end()
+{
+    Renderer::flush_batch();
 
-    return true;
+    m_frameProfiler.present_begin();
+    SDL_RenderPresent(m_renderer);
+    m_frameProfiler.present_end();
 }
 
-void sdl2::Renderer::frame_end() { SDL_RenderPresent(m_renderer); }
+sdl2::FrameProfiler &sdl2::Renderer::get_frame_profiler() noexcept { return m_frameProfiler; }
 
 bool sdl2::Renderer::render_rectangle(int x, int y, int width, int height, SDL_Color color)
 {
+    // Primitives aren't batched. Anything queued has to go out first to keep the draw order.
+    Renderer::flush_batch();
+
     if (!Renderer::set_draw_color(color)) { return false; }
 
     // Setup rect and render.
     const SDL_Rect rect = {.x = x, .y = y, .w = width, .h = height};
+    SDL2_COUNT(primitives);
     return SDL_RenderFillRect(m_renderer, &rect) == 0;
 }
 
 bool sdl2::Renderer::render_line(int xA, int yA, int xB, int yB, SDL_Color color)
 {
+    Renderer::flush_batch();
+
     if (!Renderer::set_draw_color(color)) { return false; }
 
+    SDL2_COUNT(primitives);
     return SDL_RenderDrawLine(m_renderer, xA, yA, xB, yB) == 0;
+}
+
+//                      ---- Private Functions ----
+
+bool sdl2::Renderer::render_copy(SDL_Texture *texture,
+                                 int textureWidth,
+                                 int textureHeight,
+                                 SDL_Color colorMod,
+                                 const SDL_Rect &source,
+                                 const SDL_Rect &destination)
+{
+    // Fully invisible quads never reach SDL or the batch.
+    if (!Renderer::is_visible(destination))
+    {
+        ++m_culledDraws;
+        SDL2_COUNT(culledDraws);
+        return true;
+    }
+
+    SDL2_COUNT_TEXTURE_BIND(texture);
+    if (!m_batching)
+    {
+        SDL2_COUNT(renderCopies);
+        return SDL_RenderCopy(m_renderer, texture, &source, &destination) == 0;
+    }
+
+    // Quads can only be merged while they share a texture.
+    bool flushed = true;
+    if (m_spriteBatch.get_texture() != texture) { flushed = m_spriteBatch.flush(m_renderer); }
+
+    m_spriteBatch.add_quad(texture, textureWidth, textureHeight, source, destination, colorMod);
+    SDL2_COUNT(batchedQuads);
+    return flushed;
+}
+
+void sdl2::Renderer::update_visible_rect()
+{
+    // Targets are drawn to at their own size. The frame buffer uses the logical size if there is one.
+    SDL_Rect bounds = {.x = 0, .y = 0, .w = m_targetWidth, .h = m_targetHeight};
+    if (!m_currentTarget && m_logicalWidth > 0 && m_logicalHeight > 0)
+    {
+        bounds.w = m_logicalWidth;
+        bounds.h = m_logicalHeight;
+    }
+    else if (!m_currentTarget && SDL_GetRendererOutputSize(m_renderer, &bounds.w, &bounds.h) != 0)
+    {
+        m_visibleRect.reset();
+        return;
+    }
+
+    // An unknown clip is treated as disabled. That only means culling less than it could.
+    const bool clipped = m_clipRect.has_value() && !same_clip(*m_clipRect, NO_CLIP);
+    if (!clipped)
+    {
+        m_visibleRect = bounds;
+        return;
+    }
+
+    SDL_Rect visible{};
+    SDL_IntersectRect(&bounds, &*m_clipRect, &visible);
+    m_visibleRect = visible;
 }
\ No newline at end of file
@@ -0,0 +1,72 @@
+#include "ResourceReport.hpp"
+
+#include "FontRegistry.hpp"
+
+#include <format>
+#include <fstream>
+
+namespace
+{
+    /// @brief Bytes per kibibyte.
+    constexpr double BYTES_PER_KIB = 1024.0;
+
+    /// @brief Writes the section of the report for a single manager.
+    /// @tparam ResourceType Type the manager holds.
+    /// @param reportFile File to write to.
+    /// @param label Name of the section.
+    /// @param largestCount Number of the largest resources to list.
+    template <typename ResourceType>
+    void write_section(std::ofstream &reportFile, std::string_view label, size_t largestCount)
+    {
+        using Manager = sdl2::ResourceManager<ResourceType>;
+
+        const sdl2::ResourceStats stats = Manager::get_stats();
+        reportFile << std::format("[{}]\n", label);
+        reportFile << std::format("entries: {} ({} live, {} expired)\n",
+                                  stats.entryCount,
+                                  stats.liveCount,
+                                  stats.expiredCount);
+        reportFile << std::format("lookups: {} hits, {} misses, {} created\n", stats.hits, stats.misses, stats.creates);
+        reportFile << std::format("live: {:.1f} KiB\n", stats.liveBytes / BYTES_PER_KIB);
+        reportFile << std::format("handles: {}\n", stats.handleCount);
+        reportFile << std::format("cached: {} ({:.1f} KiB)\n", stats.cachedCount, stats.cachedBytes / BYTES_PER_KIB);
+
+        for (const sdl2::ResourceUsage &usage : Manager::get_largest(largestCount))
+        {
+            reportFile << std::format("  {:>10.1f} KiB  refs {:>3}  {}\n",
+                                      usage.bytes / BYTES_PER_KIB,
+                                      usage.useCount,
+                                      usage.name);
+        }
+
+        reportFile << '\n';
+    }
+
+    /// @brief Writes the section of the report for the faces and glyph sets fonts share.
+    /// @param reportFile File to write to.
+    void write_font_registry(std::ofstream &reportFile)
+    {
+        const sdl2::FontRegistryStats stats = sdl2::FontRegistry::get_stats();
+        reportFile << "[shared font data]\n";
+        reportFile << std::format("faces: {} ({:.1f} KiB)\n", stats.faceCount, stats.faceBytes / BYTES_PER_KIB);
+        reportFile << std::format("glyph sets: {} ({:.1f} KiB of pages)\n",
+                                  stats.glyphSetCount,
+                                  stats.glyphBytes / BYTES_PER_KIB);
+        reportFile << '\n';
+    }
+}
+
+//                      ---- Public Functions ----
+
+bool sdl2::resource_report::write(std::string_view filePath, size_t largestCount)
+{
+    std::ofstream reportFile{filePath.data()};
+    if (!reportFile.is_open()) { return false; }
+
+    write_section<sdl2::Texture>(reportFile, "textures", largestCount);
+    write_section<sdl2::Font>(reportFile, "fonts", largestCount);
+    write_font_registry(reportFile);
+    write_section<sdl2::Sound>(reportFile, "sounds", largestCount);
+
+    return reportFile.good();
+}
\ No newline at end of file
@@ -0,0 +1,42 @@
+#include "ScopedRender.hpp"
+
+namespace
+{
+    /// @brief Color pooled targets are cleared to.
+    constexpr SDL_Color CLEAR_COLOR = {.r = 0x00, .g = 0x00, .b = 0x00, .a = 0x00};
+}
+
+//                      ---- Construction ----
+
+sdl2::ScopedRender::ScopedRender(sdl2::Renderer &renderer, std::shared_ptr<sdl2::Texture> target)
+    : m_renderer{renderer}
+    , m_target{std::move(target)}
+{
+    if (!m_target) { return; }
+
+    m_isActive = m_renderer.push_render_target(m_target);
+}
+
+sdl2::ScopedRender::ScopedRender(sdl2::Renderer &renderer, int width, int height, uint32_t format)
+    : m_renderer{renderer}
+    , m_target{renderer.get_target_pool().acquire(width, height, format)}
+{
+    if (!m_target) { return; }
+
+    // Pooled targets still hold whatever was rendered to them last.
+    m_isActive = m_renderer.push_render_target(m_target);
+    if (m_isActive) { m_renderer.clear(CLEAR_COLOR); }
+}
+
+sdl2::ScopedRender::~ScopedRender()
+{
+    if (!m_isActive) { return; }
+
+    m_renderer.pop_render_target();
+}
+
+//                      ---- Public Functions ----
+
+bool sdl2::ScopedRender::is_active() const noexcept { return m_isActive; }
+
+const std::shared_ptr<sdl2::Texture> &sdl2::ScopedRender::get_target() const noexcept { return m_target; }
\ No newline at end of file
@@ -15,8 +15,21 @@ sdl2::Sound::Sound(std::string_view path)
     m_soundBuffer.reset(sdlBuffer);
 }
 
+sdl2::Sound::Sound(std::span<const std::byte> data)
+{
+    SDL_RWops *sdlOps = SDL_RWFromConstMem(data.data(), data.size());
+
+    uint8_t *sdlBuffer{};
+    SDL_AudioSpec *audioSpec = SDL_LoadWAV_RW(sdlOps, 1, &m_audioSpec, &sdlBuffer, &m_audioLength);
+    if (!audioSpec) { return; }
+
+    m_soundBuffer.reset(sdlBuffer);
+}
+
 //                      ---- Public Functions ----
 
+size_t sdl2::Sound::get_byte_size() const noexcept { return m_audioLength; }
+
 void sdl2::Sound::play() const
 {
     // Bail if these aren't set.
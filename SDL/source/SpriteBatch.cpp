@@ -0,0 +1,57 @@
+#include "SpriteBatch.hpp"
+
+#include "RenderCounters.hpp"
+
+//                      ---- Public Functions ----
+
+void sdl2::SpriteBatch::add_quad(SDL_Texture *texture,
+                                 int textureWidth,
+                                 int textureHeight,
+                                 const SDL_Rect &source,
+                                 const SDL_Rect &destination,
+                                 SDL_Color color)
+{
+    m_texture = texture;
+
+    // Normalized texture coordinates.
+    const float u0 = static_cast<float>(source.x) / textureWidth;
+    const float v0 = static_cast<float>(source.y) / textureHeight;
+    const float u1 = static_cast<float>(source.x + source.w) / textureWidth;
+    const float v1 = static_cast<float>(source.y + source.h) / textureHeight;
+
+    // Corners of the destination.
+    const float x0 = destination.x;
+    const float y0 = destination.y;
+    const float x1 = destination.x + destination.w;
+    const float y1 = destination.y + destination.h;
+
+    // Index of the first vertex of this quad.
+    const int base = m_vertices.size();
+
+    m_vertices.push_back({.position = {x0, y0}, .color = color, .tex_coord = {u0, v0}});
+    m_vertices.push_back({.position = {x1, y0}, .color = color, .tex_coord = {u1, v0}});
+    m_vertices.push_back({.position = {x1, y1}, .color = color, .tex_coord = {u1, v1}});
+    m_vertices.push_back({.position = {x0, y1}, .color = color, .tex_coord = {u0, v1}});
+
+    m_indices.insert(m_indices.end(), {base, base + 1, base + 2, base + 2, base + 3, base});
+}
+
+bool sdl2::SpriteBatch::flush(SDL_Renderer *renderer)
+{
+    if (m_vertices.empty()) { return true; }
+
+    SDL2_COUNT(geometryCalls);
+    const int sdlError =
+        SDL_RenderGeometry(renderer, m_texture, m_vertices.data(), m_vertices.size(), m_indices.data(), m_indices.size());
+
+    // Clearing keeps the capacity, so the vectors stop allocating after the first few frames.
+    m_texture = nullptr;
+    m_vertices.clear();
+    m_indices.clear();
+
+    return sdlError == 0;
+}
+
+SDL_Texture *sdl2::SpriteBatch::get_texture() const noexcept { return m_texture; }
+
+bool sdl2::SpriteBatch::is_empty() const noexcept { return m_vertices.empty(); }
\ No newline at end of file
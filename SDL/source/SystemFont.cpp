@@ -1,6 +1,8 @@
 #include "SystemFont.hpp"
 
-#include <fstream>
+#include "FontRegistry.hpp"
+
+#include <vector>
 
 //                      ---- Construction ----
 
@@ -12,77 +14,21 @@ sdl2::SystemFont::SystemFont(int pixelSize)
     // Grab reference to font array.
     const auto &plFontArray = sm_plService.m_sharedFonts;
 
-    // Loop through, load, and size.
-    size_t faceIndex{};
+    // Get the face of every shared font. Codepoints are searched for in this order.
+    std::vector<std::shared_ptr<sdl2::FontFace>> faces{};
     for (const PlFontData &fontData : plFontArray)
     {
-        // This makes the next thing easier to read.
-        const FT_Byte *fontBinary = reinterpret_cast<const FT_Byte *>(fontData.address);
-
-        // Init face.
-        const FT_Error faceError =
-            FT_New_Memory_Face(sm_freetype.m_library, fontBinary, fontData.size, 0, &m_fontFaces[faceIndex]);
-        if (faceError != 0) { continue; }
-
-        // Set the pixel size.
-        FT_Set_Pixel_Sizes(m_fontFaces[faceIndex++], 0, m_pixelSize);
-    }
-}
+        if (!fontData.address) { continue; }
 
-sdl2::SystemFont::~SystemFont()
-{
-    // Loop and free faces.
-    for (FT_Face fontFace : m_fontFaces) { FT_Done_Face(fontFace); }
-}
-
-//                      ---- Private Functions ----
-
-OptionalReference<sdl2::Font::GlyphData> sdl2::SystemFont::find_load_glyph(uint32_t codepoint)
-{
-    // Search first.
-    const auto findGlyph = m_cacheMap.find(codepoint);
-    if (findGlyph != m_cacheMap.end()) { return findGlyph->second; }
+        // This makes the next thing easier to read.
+        const std::byte *fontBinary = reinterpret_cast<const std::byte *>(fontData.address);
 
-    // Loop and try to find the index.
-    FT_Face fontFace{};
-    FT_UInt charIndex{};
-    for (FT_Face currentFace : m_fontFaces)
-    {
-        if (!currentFace) { continue; }
+        std::shared_ptr<sdl2::FontFace> face = sdl2::FontRegistry::load_face({fontBinary, fontData.size});
+        if (!face->is_initialized()) { continue; }
 
-        // Try to get the index. If it's found, break the loop.
-        charIndex = FT_Get_Char_Index(currentFace, codepoint);
-        if (charIndex != 0)
-        {
-            fontFace = currentFace;
-            break;
-        }
+        faces.push_back(std::move(face));
     }
 
-    // If the character index is still 0 here, bail.
-    if (charIndex == 0) { return std::nullopt; }
-
-    // Load and render the glyph.
-    const FT_Error loadError = FT_Load_Glyph(fontFace, charIndex, FT_LOAD_RENDER);
-    if (loadError != 0) { return std::nullopt; }
-
-    // Make things easier to read and type.
-    const FT_GlyphSlot glyphSlot = fontFace->glyph;
-    const FT_Bitmap glyphBitmap  = glyphSlot->bitmap;
-
-    // Convert.
-    sdl2::SharedTexture glyphTexture = Font::convert_glyph_to_texture(codepoint, glyphBitmap);
-
-    // Data for cache.
-    const Font::GlyphData cacheData = {.advanceX = static_cast<int16_t>(glyphSlot->advance.x >> 6),
-                                       .top      = static_cast<int16_t>(glyphSlot->bitmap_top),
-                                       .left     = static_cast<int16_t>(glyphSlot->bitmap_left),
-                                       .texture  = glyphTexture};
-
-    // Map is weird and returns this as a pair?
-    const auto emplacePair = m_cacheMap.try_emplace(codepoint, cacheData);
-    if (!emplacePair.second) { return std::nullopt; }
-
-    // Finally return.
-    return m_cacheMap.at(codepoint);
+    m_glyphSet      = sdl2::FontRegistry::get_glyph_set(faces, m_pixelSize);
+    m_isInitialized = m_glyphSet->is_initialized();
 }
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include "TextLayout.hpp"
+
+#include <algorithm>
+
+//                      ---- TextLayout ----
+
+int sdl2::TextLayout::get_width() const noexcept { return m_width; }
+
+int sdl2::TextLayout::get_height() const noexcept { return m_height; }
+
+size_t sdl2::TextLayout::get_glyph_count() const noexcept { return m_glyphs.size(); }
+
+//                      ---- Construction ----
+
+sdl2::TextLayoutCache::TextLayoutCache(size_t capacity)
+    : m_capacity{std::max<size_t>(capacity, 1)} {}
+
+//                      ---- Public Functions ----
+
+const sdl2::TextLayout *sdl2::TextLayoutCache::find(std::string_view text, int maxWidth)
+{
+    const auto findEntry = m_entryMap.find(TextLayoutCache::Key{.text = text, .maxWidth = maxWidth});
+    if (findEntry == m_entryMap.end()) { return nullptr; }
+
+    // Move it to the front. Splicing doesn't invalidate the iterator or the text the key points to.
+    auto entry = findEntry->second;
+    m_entries.splice(m_entries.begin(), m_entries, entry);
+
+    return &entry->layout;
+}
+
+const sdl2::TextLayout &sdl2::TextLayoutCache::insert(std::string_view text, int maxWidth, sdl2::TextLayout layout)
+{
+    // Replace the old entry if there is one.
+    const auto findEntry = m_entryMap.find(TextLayoutCache::Key{.text = text, .maxWidth = maxWidth});
+    if (findEntry != m_entryMap.end())
+    {
+        auto entry    = findEntry->second;
+        entry->layout = std::move(layout);
+        m_entries.splice(m_entries.begin(), m_entries, entry);
+        return entry->layout;
+    }
+
+    m_entries.push_front({.text = std::string{text}, .maxWidth = maxWidth, .layout = std::move(layout)});
+
+    // The key needs to point at the copy the list owns.
+    auto entry = m_entries.begin();
+    m_entryMap.try_emplace(TextLayoutCache::Key{.text = entry->text, .maxWidth = maxWidth}, entry);
+
+    TextLayoutCache::trim();
+    return entry->layout;
+}
+
+void sdl2::TextLayoutCache::set_capacity(size_t capacity)
+{
+    m_capacity = std::max<size_t>(capacity, 1);
+    TextLayoutCache::trim();
+}
+
+void sdl2::TextLayoutCache::clear()
+{
+    m_entryMap.clear();
+    m_entries.clear();
+}
+
+//                      ---- Private Functions ----
+
+void sdl2::TextLayoutCache::trim()
+{
+    while (m_entries.size() > m_capacity)
+    {
+        const TextLayoutCache::Entry &last = m_entries.back();
+        m_entryMap.erase(TextLayoutCache::Key{.text = last.text, .maxWidth = last.maxWidth});
+        m_entries.pop_back();
+    }
+}
\ No newline at end of file
@@ -3,7 +3,7 @@
 #include <SDL2/SDL_image.h>
 
 #define RETURN_ON_INVALID_RENDERER(renderer)                                                                                   \
-    if (!renderer) { return; }
+    if (!renderer || !renderer->m_renderer) { return; }
 
 #define RETURN_ON_INVALID_TEXTURE(renderer, texture)                                                                           \
     if (!renderer || !texture) { return false; }
@@ -14,8 +14,16 @@ sdl2::Texture::Texture(std::string_view filePath)
 {
     RETURN_ON_INVALID_RENDERER(sm_renderer);
 
+    // QOI goes through the built in decoder instead of SDL_image.
+    if (sdl2::qoi::has_extension(filePath))
+    {
+        sdl2::Surface surface = sdl2::surface::from_file(filePath);
+        Texture::load_surface(surface);
+        return;
+    }
+
     // Load the texture.
-    m_texture = IMG_LoadTexture(sm_renderer, filePath.data());
+    m_texture = IMG_LoadTexture(sm_renderer->m_renderer, filePath.data());
     if (!m_texture) { return; }
 
     // Query and get its width and height.
@@ -26,42 +34,44 @@ sdl2::Texture::Texture(std::string_view filePath)
     m_isInitialized = true;
 }
 
-sdl2::Texture::Texture(sdl2::Surface &surface)
-    : m_width(surface.get()->w)
-    , m_height(surface.get()->h)
-{
-    RETURN_ON_INVALID_RENDERER(sm_renderer);
-
-    // Create texture from surface & blend.
-    m_texture        = SDL_CreateTextureFromSurface(sm_renderer, surface.get());
-    const bool blend = m_texture && Texture::set_blend_mode();
-    if (!m_texture || !blend) { return; }
-
-    m_isInitialized = true;
-}
+sdl2::Texture::Texture(sdl2::Surface &surface) { Texture::load_surface(surface); }
 
 sdl2::Texture::Texture(const void *data, size_t dataSize)
 {
     RETURN_ON_INVALID_RENDERER(sm_renderer);
 
+    if (sdl2::qoi::is_qoi(data, dataSize))
+    {
+        sdl2::Surface surface{sdl2::qoi::decode(data, dataSize), SDL_FreeSurface};
+        Texture::load_surface(surface);
+        return;
+    }
+
     // SDL RWOps.
     SDL_RWops *sdlOps = SDL_RWFromConstMem(data, dataSize);
 
     // Load.
-    m_texture        = IMG_LoadTexture_RW(sm_renderer, sdlOps, 1L);
-    const bool blend = m_texture && Texture::set_blend_mode();
-    if (!m_texture || !blend) { return; }
+    m_texture = IMG_LoadTexture_RW(sm_renderer->m_renderer, sdlOps, 1L);
+    if (!m_texture) { return; }
+
+    // The size isn't known until it's decoded.
+    const bool query = SDL_QueryTexture(m_texture, nullptr, nullptr, &m_width, &m_height) == 0;
+    const bool blend = Texture::set_blend_mode();
+    if (!query || !blend) { return; }
 
     m_isInitialized = true;
 }
 
-sdl2::Texture::Texture(int width, int height, SDL_TextureAccess textureAccess)
+sdl2::Texture::Texture(std::span<const std::byte> data)
+    : Texture(data.data(), data.size()) {}
+
+sdl2::Texture::Texture(int width, int height, SDL_TextureAccess textureAccess, uint32_t format)
     : m_width(width)
     , m_height(height)
 {
     RETURN_ON_INVALID_RENDERER(sm_renderer);
 
-    m_texture        = SDL_CreateTexture(sm_renderer, SDL_PIXELFORMAT_ARGB8888, textureAccess, width, height);
+    m_texture        = SDL_CreateTexture(sm_renderer->m_renderer, format, textureAccess, width, height);
     const bool blend = m_texture && Texture::set_blend_mode();
     if (!m_texture || !blend) { return; }
 
@@ -70,7 +80,11 @@ sdl2::Texture::Texture(int width, int height, SDL_TextureAccess textureAccess)
 
 sdl2::Texture::~Texture()
 {
-    if (!m_texture) { return; }
+    // SDL_DestroyRenderer already freed every texture of a renderer that's gone.
+    if (!m_texture || !sm_renderer) { return; }
+
+    // Don't leave the batch pointing at a destroyed texture.
+    if (sm_renderer->m_spriteBatch.get_texture() == m_texture) { sm_renderer->flush_batch(); }
 
     SDL_DestroyTexture(m_texture);
 }
@@ -81,9 +95,74 @@ int sdl2::Texture::get_width() const noexcept { return m_width; }
 
 int sdl2::Texture::get_height() const noexcept { return m_height; }
 
-bool sdl2::Texture::set_blend_mode(SDL_BlendMode mode) { return SDL_SetTextureBlendMode(m_texture, mode) == 0; }
+size_t sdl2::Texture::get_byte_size() const noexcept { return static_cast<size_t>(m_width) * m_height * 4; }
+
+bool sdl2::Texture::set_blend_mode(SDL_BlendMode mode)
+{
+    if (mode == m_blendMode) { return Texture::skip_state_change(); }
 
-bool sdl2::Texture::set_color_mod(SDL_Color color) { return SDL_SetTextureColorMod(m_texture, color.r, color.g, color.b) == 0; }
+    // Textures still waiting on an upload keep the mode so it's applied once they're created.
+    if (!m_texture)
+    {
+        m_blendMode = mode;
+        return true;
+    }
+
+    // Queued quads are blended with whatever mode the texture has when they're submitted.
+    if (sm_renderer && sm_renderer->m_spriteBatch.get_texture() == m_texture) { sm_renderer->flush_batch(); }
+
+    const bool modeSet = SDL_SetTextureBlendMode(m_texture, mode) == 0;
+    m_blendMode        = modeSet ? mode : SDL_BLENDMODE_INVALID;
+
+    return modeSet;
+}
+
+bool sdl2::Texture::set_color_mod(SDL_Color color)
+{
+    const bool unchanged = m_colorMod.r == color.r && m_colorMod.g == color.g && m_colorMod.b == color.b;
+    if (unchanged) { return Texture::skip_state_change(); }
+
+    // Same as the blend mode. Textures still waiting on an upload get the mod applied once they're created. Otherwise
+    // the shadow only changes if SDL took it, so a failed call is retried next time.
+    const bool modSet = !m_texture || SDL_SetTextureColorMod(m_texture, color.r, color.g, color.b) == 0;
+    if (modSet)
+    {
+        m_colorMod.r = color.r;
+        m_colorMod.g = color.g;
+        m_colorMod.b = color.b;
+    }
+
+    return modSet;
+}
+
+bool sdl2::Texture::set_alpha_mod(uint8_t alpha)
+{
+    if (m_colorMod.a == alpha) { return Texture::skip_state_change(); }
+
+    const bool modSet = !m_texture || SDL_SetTextureAlphaMod(m_texture, alpha) == 0;
+    if (modSet) { m_colorMod.a = alpha; }
+
+    return modSet;
+}
+
+bool sdl2::Texture::update_region(int x, int y, sdl2::Surface &surface)
+{
+    if (!m_texture || !surface) { return false; }
+
+    // SDL_UpdateTexture expects the pixels to already be in the texture's format.
+    sdl2::Surface converted{nullptr, SDL_FreeSurface};
+    SDL_Surface *source = surface.get();
+    if (source->format->format != SDL_PIXELFORMAT_ARGB8888)
+    {
+        converted.reset(SDL_ConvertSurfaceFormat(source, SDL_PIXELFORMAT_ARGB8888, 0));
+        if (!converted) { return false; }
+
+        source = converted.get();
+    }
+
+    const SDL_Rect region = {.x = x, .y = y, .w = source->w, .h = source->h};
+    return SDL_UpdateTexture(m_texture, &region, source->pixels, source->pitch) == 0;
+}
 
 bool sdl2::Texture::render(int x, int y)
 {
@@ -95,7 +174,7 @@ bool sdl2::Texture::render(int x, int y)
     const SDL_Rect destRect   = {.x = x, .y = y, .w = m_width, .h = m_height};
 
     // Return success or not.
-    return SDL_RenderCopy(sm_renderer, m_texture, &sourceRect, &destRect) == 0;
+    return sm_renderer->render_copy(m_texture, m_width, m_height, m_colorMod, sourceRect, destRect);
 }
 
 bool sdl2::Texture::render_part(int x, int y, int sourceX, int sourceY, int sourceWidth, int sourceHeight)
@@ -105,7 +184,7 @@ bool sdl2::Texture::render_part(int x, int y, int sourceX, int sourceY, int sour
     const SDL_Rect sourceRect = {.x = sourceX, .y = sourceY, .w = sourceWidth, .h = sourceHeight};
     const SDL_Rect destRect   = {.x = x, .y = y, .w = sourceWidth, .h = sourceHeight};
 
-    return SDL_RenderCopy(sm_renderer, m_texture, &sourceRect, &destRect) == 0;
+    return sm_renderer->render_copy(m_texture, m_width, m_height, m_colorMod, sourceRect, destRect);
 }
 
 bool sdl2::Texture::render_stretched(int x, int y, int width, int height)
@@ -115,7 +194,7 @@ bool sdl2::Texture::render_stretched(int x, int y, int width, int height)
     const SDL_Rect sourceRect = {.x = 0, .y = 0, .w = m_width, .h = m_height};
     const SDL_Rect destRect   = {.x = x, .y = y, .w = width, .h = height};
 
-    return SDL_RenderCopy(sm_renderer, m_texture, &sourceRect, &destRect) == 0;
+    return sm_renderer->render_copy(m_texture, m_width, m_height, m_colorMod, sourceRect, destRect);
 }
 
 bool sdl2::Texture::render_part_stretched(int x,
@@ -132,7 +211,53 @@ bool sdl2::Texture::render_part_stretched(int x,
     const SDL_Rect sourceRect = {.x = sourceX, .y = sourceY, .w = sourceWidth, .h = sourceHeight};
     const SDL_Rect destRect   = {.x = x, .y = y, .w = width, .h = height};
 
-    return SDL_RenderCopy(sm_renderer, m_texture, &sourceRect, &destRect) == 0;
+    return sm_renderer->render_copy(m_texture, m_width, m_height, m_colorMod, sourceRect, destRect);
 }
 
-void sdl2::Texture::initialize(const sdl2::Renderer &renderer) { sm_renderer = renderer.m_renderer; }
+void sdl2::Texture::initialize(sdl2::Renderer &renderer) { sm_renderer = &renderer; }
+
+sdl2::Renderer *sdl2::Texture::get_renderer() noexcept { return sm_renderer; }
+
+SDL_BlendMode sdl2::Texture::get_premultiplied_blend_mode() noexcept
+{
+    // The color was already multiplied by its alpha when it was drawn, so only the destination is scaled.
+    static const SDL_BlendMode premultiplied = SDL_ComposeCustomBlendMode(SDL_BLENDFACTOR_ONE,
+                                                                          SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                                                                          SDL_BLENDOPERATION_ADD,
+                                                                          SDL_BLENDFACTOR_ONE,
+                                                                          SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+                                                                          SDL_BLENDOPERATION_ADD);
+    return premultiplied;
+}
+
+//                      ---- Private Functions ----
+
+bool sdl2::Texture::load_surface(sdl2::Surface &surface)
+{
+    if (!sm_renderer || !sm_renderer->m_renderer || !surface || m_texture) { return false; }
+
+    // Create texture from surface & blend.
+    m_texture = SDL_CreateTextureFromSurface(sm_renderer->m_renderer, surface.get());
+    if (!m_texture) { return false; }
+
+    m_width  = surface->w;
+    m_height = surface->h;
+
+    // Mods and the blend mode set before the texture existed still need to be applied.
+    const SDL_BlendMode blendMode = m_blendMode == SDL_BLENDMODE_INVALID ? SDL_BLENDMODE_BLEND : m_blendMode;
+    m_blendMode                   = SDL_BLENDMODE_INVALID;
+    const bool blend              = Texture::set_blend_mode(blendMode);
+    const bool color = SDL_SetTextureColorMod(m_texture, m_colorMod.r, m_colorMod.g, m_colorMod.b) == 0;
+    const bool alpha = SDL_SetTextureAlphaMod(m_texture, m_colorMod.a) == 0;
+    if (!blend || !color || !alpha) { return false; }
+
+    m_isInitialized = true;
+    return true;
+}
+
+bool sdl2::Texture::skip_state_change() noexcept
+{
+    if (sm_renderer) { ++sm_renderer->m_skippedStateChanges; }
+
+    return true;
+}
@@ -0,0 +1,242 @@
+#include "TextureAtlas.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace
+{
+    /// @brief Returned by get_page for out of range indexes.
+    const std::shared_ptr<sdl2::Texture> NULL_PAGE{};
+}
+
+//                      ---- SubTexture ----
+
+sdl2::SubTexture::SubTexture(std::shared_ptr<sdl2::Texture> page, SDL_Rect source)
+    : m_page{std::move(page)}
+    , m_source{source} {}
+
+bool sdl2::SubTexture::is_initialized() const noexcept { return m_page && m_page->is_initialized(); }
+
+int sdl2::SubTexture::get_width() const noexcept { return m_source.w; }
+
+int sdl2::SubTexture::get_height() const noexcept { return m_source.h; }
+
+const SDL_Rect &sdl2::SubTexture::get_source() const noexcept { return m_source; }
+
+const std::shared_ptr<sdl2::Texture> &sdl2::SubTexture::get_page() const noexcept { return m_page; }
+
+bool sdl2::SubTexture::set_color_mod(SDL_Color color) { return m_page && m_page->set_color_mod(color); }
+
+bool sdl2::SubTexture::render(int x, int y)
+{
+    if (!m_page) { return false; }
+
+    return m_page->render_part(x, y, m_source.x, m_source.y, m_source.w, m_source.h);
+}
+
+bool sdl2::SubTexture::render_part(int x, int y, int sourceX, int sourceY, int sourceWidth, int sourceHeight)
+{
+    if (!m_page) { return false; }
+
+    return m_page->render_part(x, y, m_source.x + sourceX, m_source.y + sourceY, sourceWidth, sourceHeight);
+}
+
+bool sdl2::SubTexture::render_stretched(int x, int y, int width, int height)
+{
+    if (!m_page) { return false; }
+
+    return m_page->render_part_stretched(x, y, width, height, m_source.x, m_source.y, m_source.w, m_source.h);
+}
+
+//                      ---- Construction ----
+
+sdl2::TextureAtlas::TextureAtlas(int pageWidth, int pageHeight, int padding)
+    : m_pageWidth{pageWidth}
+    , m_pageHeight{pageHeight}
+    , m_padding{padding} {}
+
+//                      ---- Public Functions ----
+
+sdl2::SubTexture sdl2::TextureAtlas::add_image(std::string_view name, std::string_view filePath)
+{
+    // Don't bother loading the image if it's already packed.
+    sdl2::SubTexture existing = TextureAtlas::find(name);
+    if (existing.is_initialized()) { return existing; }
+
+    sdl2::Surface imageSurface = sdl2::surface::from_file(filePath);
+    if (!imageSurface) { return {}; }
+
+    return TextureAtlas::add_surface(name, imageSurface);
+}
+
+sdl2::SubTexture sdl2::TextureAtlas::add_surface(std::string_view name, sdl2::Surface &surface)
+{
+    sdl2::SubTexture existing = TextureAtlas::find(name);
+    if (existing.is_initialized()) { return existing; }
+
+    const auto region = TextureAtlas::pack(surface);
+    if (!region.has_value()) { return {}; }
+
+    m_regionMap.try_emplace(std::string{name}, *region);
+    return sdl2::SubTexture{m_pages[region->page].texture, region->source};
+}
+
+std::optional<sdl2::TextureAtlas::Region> sdl2::TextureAtlas::pack(sdl2::Surface &surface)
+{
+    if (!surface) { return std::nullopt; }
+
+    // Padding is added to the right and bottom of every image.
+    const int paddedWidth  = surface->w + m_padding;
+    const int paddedHeight = surface->h + m_padding;
+    if (paddedWidth > m_pageWidth || paddedHeight > m_pageHeight) { return std::nullopt; }
+
+    // Try the pages we already have first. Only the last couple are likely to have room, so search backwards.
+    const int pageCount = m_pages.size();
+    for (int i = pageCount - 1; i >= 0; i--)
+    {
+        TextureAtlas::Page &page = m_pages[i];
+
+        SDL_Rect rect{};
+        const int nodeIndex = TextureAtlas::find_position(page, paddedWidth, paddedHeight, rect);
+        if (nodeIndex < 0) { continue; }
+
+        TextureAtlas::add_skyline_level(page, nodeIndex, rect);
+
+        // The region returned doesn't include the padding.
+        const SDL_Rect source = {.x = rect.x, .y = rect.y, .w = surface->w, .h = surface->h};
+        if (!page.texture->update_region(source.x, source.y, surface)) { return std::nullopt; }
+
+        return TextureAtlas::Region{.page = i, .source = source};
+    }
+
+    // Nothing had room. Allocate a new page and try again.
+    if (!TextureAtlas::allocate_page()) { return std::nullopt; }
+
+    return TextureAtlas::pack(surface);
+}
+
+sdl2::SubTexture sdl2::TextureAtlas::find(std::string_view name) const
+{
+    const auto findRegion = m_regionMap.find(name);
+    if (findRegion == m_regionMap.end()) { return {}; }
+
+    const TextureAtlas::Region &region = findRegion->second;
+    return sdl2::SubTexture{m_pages[region.page].texture, region.source};
+}
+
+int sdl2::TextureAtlas::get_page_count() const noexcept { return m_pages.size(); }
+
+const std::shared_ptr<sdl2::Texture> &sdl2::TextureAtlas::get_page(int page) const noexcept
+{
+    if (page < 0 || page >= static_cast<int>(m_pages.size())) { return NULL_PAGE; }
+
+    return m_pages[page].texture;
+}
+
+//                      ---- Private Functions ----
+
+bool sdl2::TextureAtlas::allocate_page()
+{
+    auto pageTexture = std::make_shared<sdl2::Texture>(m_pageWidth, m_pageHeight, SDL_TEXTUREACCESS_STATIC);
+    if (!pageTexture->is_initialized()) { return false; }
+
+    // Static textures start out with undefined contents. SDL zeroes new surfaces, so uploading one clears the page.
+    SDL_Surface *blank = SDL_CreateRGBSurfaceWithFormat(0, m_pageWidth, m_pageHeight, 32, SDL_PIXELFORMAT_ARGB8888);
+    sdl2::Surface clearSurface{blank, SDL_FreeSurface};
+    if (!clearSurface) { return false; }
+
+    if (!pageTexture->update_region(0, 0, clearSurface)) { return false; }
+
+    // The skyline starts as a single node spanning the entire page.
+    TextureAtlas::Page newPage = {.texture = pageTexture, .skyline = {{.x = 0, .y = 0, .width = m_pageWidth}}};
+    m_pages.push_back(std::move(newPage));
+
+    return true;
+}
+
+int sdl2::TextureAtlas::find_position(const TextureAtlas::Page &page, int width, int height, SDL_Rect &rect) const noexcept
+{
+    // Bottom-left heuristic: Lowest resulting top edge wins, narrowest node breaks ties.
+    int bestIndex  = -1;
+    int bestBottom = std::numeric_limits<int>::max();
+    int bestWidth  = std::numeric_limits<int>::max();
+
+    const size_t nodeCount = page.skyline.size();
+    for (size_t i = 0; i < nodeCount; i++)
+    {
+        const int y = TextureAtlas::fit_node(page, i, width, height);
+        if (y < 0) { continue; }
+
+        const SkylineNode &node = page.skyline[i];
+        const int bottom        = y + height;
+        if (bottom < bestBottom || (bottom == bestBottom && node.width < bestWidth))
+        {
+            bestIndex  = i;
+            bestBottom = bottom;
+            bestWidth  = node.width;
+            rect       = {.x = node.x, .y = y, .w = width, .h = height};
+        }
+    }
+
+    return bestIndex;
+}
+
+int sdl2::TextureAtlas::fit_node(const TextureAtlas::Page &page, size_t nodeIndex, int width, int height) const noexcept
+{
+    const std::vector<SkylineNode> &skyline = page.skyline;
+
+    // Make sure it doesn't run off the right side.
+    const int x = skyline[nodeIndex].x;
+    if (x + width > m_pageWidth) { return -1; }
+
+    // The rectangle has to sit on top of the highest node it spans.
+    int y              = skyline[nodeIndex].y;
+    int widthRemaining = width;
+    for (size_t i = nodeIndex; widthRemaining > 0 && i < skyline.size(); i++)
+    {
+        y = std::max(y, skyline[i].y);
+        if (y + height > m_pageHeight) { return -1; }
+
+        widthRemaining -= skyline[i].width;
+    }
+
+    return y;
+}
+
+void sdl2::TextureAtlas::add_skyline_level(TextureAtlas::Page &page, size_t nodeIndex, const SDL_Rect &rect)
+{
+    std::vector<SkylineNode> &skyline = page.skyline;
+
+    // Insert the new level.
+    const SkylineNode newNode = {.x = rect.x, .y = rect.y + rect.h, .width = rect.w};
+    skyline.insert(skyline.begin() + nodeIndex, newNode);
+
+    // Shrink or remove the nodes the new one now covers.
+    for (size_t i = nodeIndex + 1; i < skyline.size();)
+    {
+        SkylineNode &previous = skyline[i - 1];
+        SkylineNode &current  = skyline[i];
+
+        const int overlap = previous.x + previous.width - current.x;
+        if (overlap <= 0) { break; }
+
+        current.x += overlap;
+        current.width -= overlap;
+        if (current.width > 0) { break; }
+
+        skyline.erase(skyline.begin() + i);
+    }
+
+    // Merge neighbours at the same height.
+    for (size_t i = 0; i + 1 < skyline.size();)
+    {
+        if (skyline[i].y == skyline[i + 1].y)
+        {
+            skyline[i].width += skyline[i + 1].width;
+            skyline.erase(skyline.begin() + i + 1);
+            continue;
+        }
+
+        ++i;
+    }
+}
\ No newline at end of file
@@ -0,0 +1,169 @@
+#include "TextureLoader.hpp"
+
+#include "ResourceManager.hpp"
+
+#include <cstdint>
+
+namespace
+{
+    /// @brief Format images are converted to on the worker so the upload doesn't need to.
+    constexpr uint32_t UPLOAD_FORMAT = SDL_PIXELFORMAT_ARGB8888;
+}
+
+//                      ---- Construction ----
+
+sdl2::TextureLoader::~TextureLoader()
+{
+    if (m_workers.empty()) { return; }
+
+    {
+        std::lock_guard<std::mutex> queueGuard{m_queueLock};
+        m_exitWorker = true;
+    }
+    m_queueCondition.notify_all();
+
+    for (std::thread &worker : m_workers) { worker.join(); }
+}
+
+//                      ---- Public Functions ----
+
+std::shared_ptr<sdl2::Texture> sdl2::TextureLoader::load_async(std::string_view name, std::string_view filePath)
+{
+    TextureLoader &instance = TextureLoader::get_instance();
+
+    // Loaded or already queued textures are returned as is.
+    std::shared_ptr<sdl2::Texture> texture = sdl2::TextureManager::create_load_resource(name);
+    sdl2::TextureManager::record_request(name, filePath);
+    if (texture->is_initialized() || instance.find_pending(texture)) { return texture; }
+
+    instance.m_pending.insert_or_assign(texture.get(), texture);
+    {
+        std::lock_guard<std::mutex> queueGuard{instance.m_queueLock};
+        instance.m_decodeQueue.push_back({.key = texture.get(), .texture = texture, .filePath = std::string{filePath}});
+    }
+    instance.m_queueCondition.notify_one();
+
+    // Workers are started the first time they're needed.
+    for (size_t i = instance.m_workers.size(); i < instance.m_workerCount; i++)
+    {
+        instance.m_workers.emplace_back(&TextureLoader::worker_main, &instance);
+    }
+
+    return texture;
+}
+
+bool sdl2::TextureLoader::is_pending(const std::shared_ptr<sdl2::Texture> &texture)
+{
+    return TextureLoader::get_instance().find_pending(texture);
+}
+
+size_t sdl2::TextureLoader::get_pending_count() { return TextureLoader::get_instance().m_pending.size(); }
+
+void sdl2::TextureLoader::set_upload_budget(size_t bytes) { TextureLoader::get_instance().m_uploadBudget = bytes; }
+
+void sdl2::TextureLoader::set_worker_count(size_t count)
+{
+    TextureLoader &instance = TextureLoader::get_instance();
+    if (!instance.m_workers.empty() || count == 0) { return; }
+
+    instance.m_workerCount = count;
+}
+
+void sdl2::TextureLoader::process_uploads()
+{
+    TextureLoader &instance = TextureLoader::get_instance();
+    instance.upload(instance.m_uploadBudget);
+}
+
+void sdl2::TextureLoader::finish_pending()
+{
+    TextureLoader &instance = TextureLoader::get_instance();
+    while (!instance.m_pending.empty())
+    {
+        {
+            std::unique_lock<std::mutex> queueLock{instance.m_queueLock};
+            instance.m_uploadCondition.wait(queueLock, [&]() { return !instance.m_uploadQueue.empty(); });
+        }
+
+        instance.upload(SIZE_MAX);
+    }
+}
+
+//                      ---- Private Functions ----
+
+sdl2::TextureLoader &sdl2::TextureLoader::get_instance()
+{
+    static TextureLoader instance;
+    return instance;
+}
+
+void sdl2::TextureLoader::upload(size_t budget)
+{
+    if (m_pending.empty()) { return; }
+
+    // The first texture goes up no matter the budget. Otherwise a budget of 0 or smaller than a texture would stall.
+    bool uploadedAny{};
+    size_t uploaded{};
+    while (!uploadedAny || uploaded < budget)
+    {
+        TextureLoader::DecodedImage decoded{};
+        {
+            std::lock_guard<std::mutex> queueGuard{m_queueLock};
+            if (m_uploadQueue.empty()) { return; }
+
+            decoded = std::move(m_uploadQueue.front());
+            m_uploadQueue.pop_front();
+        }
+
+        // The address could've been reused by a newer texture if this one was released, so make sure it's the same.
+        const auto findPending = m_pending.find(decoded.key);
+        const bool sameTexture = findPending != m_pending.end() && !findPending->second.owner_before(decoded.texture) &&
+                                 !decoded.texture.owner_before(findPending->second);
+        if (sameTexture) { m_pending.erase(findPending); }
+
+        // Released textures and failed decodes have nothing to upload. Failed ones stay uninitialized for good.
+        std::shared_ptr<sdl2::Texture> texture = decoded.texture.lock();
+        if (!texture || !decoded.surface) { continue; }
+
+        texture->load_surface(decoded.surface);
+        uploaded += decoded.surface->pitch * decoded.surface->h;
+        uploadedAny = true;
+    }
+}
+
+bool sdl2::TextureLoader::find_pending(const std::shared_ptr<sdl2::Texture> &texture) const
+{
+    const auto findPending = m_pending.find(texture.get());
+    return findPending != m_pending.end() && findPending->second.lock() == texture;
+}
+
+void sdl2::TextureLoader::worker_main()
+{
+    for (;;)
+    {
+        TextureLoader::DecodeJob job{};
+        {
+            std::unique_lock<std::mutex> queueLock{m_queueLock};
+            m_queueCondition.wait(queueLock, [this]() { return m_exitWorker || !m_decodeQueue.empty(); });
+            if (m_exitWorker) { return; }
+
+            job = std::move(m_decodeQueue.front());
+            m_decodeQueue.pop_front();
+        }
+
+        // Don't bother decoding something nobody wants anymore. It still goes through so it's no longer pending.
+        sdl2::Surface surface{nullptr, SDL_FreeSurface};
+        if (!job.texture.expired()) { surface = sdl2::surface::from_file(job.filePath); }
+
+        if (surface && surface->format->format != UPLOAD_FORMAT)
+        {
+            surface.reset(SDL_ConvertSurfaceFormat(surface.get(), UPLOAD_FORMAT, 0));
+        }
+
+        {
+            std::lock_guard<std::mutex> queueGuard{m_queueLock};
+            m_uploadQueue.push_back({.key = job.key, .texture = std::move(job.texture), .surface = std::move(surface)});
+        }
+        m_uploadCondition.notify_one();
+    }
+}
\ No newline at end of file
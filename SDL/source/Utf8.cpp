@@ -0,0 +1,148 @@
+#include "Utf8.hpp"
+
+#include <cstring>
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+    /// @brief Number of bytes checked and widened at once.
+    constexpr size_t BLOCK_SIZE = 16;
+
+    /// @brief Highest valid codepoint.
+    constexpr uint32_t MAX_CODEPOINT = 0x10FFFF;
+
+    /// @brief Range of codepoints reserved for UTF-16 surrogates. These aren't valid in UTF-8.
+    constexpr uint32_t SURROGATE_FIRST = 0xD800;
+    constexpr uint32_t SURROGATE_LAST  = 0xDFFF;
+
+    /// @brief Widens a block of ASCII to codepoints.
+    /// @param data Block to widen. Must be BLOCK_SIZE bytes.
+    /// @param codepoints Where to write the codepoints. Must have room for BLOCK_SIZE.
+    /// @return True if the block was ASCII and was written. False if it wasn't. Nothing is written then.
+    inline bool widen_ascii_block(const uint8_t *data, uint32_t *codepoints) noexcept
+    {
+#if defined(__aarch64__) && defined(__ARM_NEON)
+        const uint8x16_t bytes = vld1q_u8(data);
+        if (vmaxvq_u8(bytes) >= 0x80) { return false; }
+
+        const uint16x8_t low  = vmovl_u8(vget_low_u8(bytes));
+        const uint16x8_t high = vmovl_high_u8(bytes);
+        vst1q_u32(codepoints, vmovl_u16(vget_low_u16(low)));
+        vst1q_u32(codepoints + 4, vmovl_high_u16(low));
+        vst1q_u32(codepoints + 8, vmovl_u16(vget_low_u16(high)));
+        vst1q_u32(codepoints + 12, vmovl_high_u16(high));
+        return true;
+#elif defined(__SSE2__)
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data));
+        if (_mm_movemask_epi8(bytes) != 0) { return false; }
+
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i low  = _mm_unpacklo_epi8(bytes, zero);
+        const __m128i high = _mm_unpackhi_epi8(bytes, zero);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(codepoints), _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(codepoints + 4), _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(codepoints + 8), _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(codepoints + 12), _mm_unpackhi_epi16(high, zero));
+        return true;
+#else
+        static constexpr uint64_t HIGH_BITS = 0x8080808080808080;
+
+        uint64_t words[2]{};
+        std::memcpy(words, data, BLOCK_SIZE);
+        if (((words[0] | words[1]) & HIGH_BITS) != 0) { return false; }
+
+        for (size_t i = 0; i < BLOCK_SIZE; i++) { codepoints[i] = data[i]; }
+        return true;
+#endif
+    }
+}
+
+//                      ---- Public Functions ----
+
+ssize_t sdl2::utf8::decode(uint32_t *codepoint, const uint8_t *data, size_t length) noexcept
+{
+    if (length == 0) { return 0; }
+
+    const uint8_t lead = data[0];
+    if (lead < 0x80)
+    {
+        *codepoint = lead;
+        return 1;
+    }
+
+    // The lead byte gives the length of the sequence and the first bits of the codepoint.
+    size_t unitCount{};
+    uint32_t value{};
+    uint32_t minimum{};
+    if ((lead & 0xE0) == 0xC0)
+    {
+        unitCount = 2;
+        value     = lead & 0x1F;
+        minimum   = 0x80;
+    }
+    else if ((lead & 0xF0) == 0xE0)
+    {
+        unitCount = 3;
+        value     = lead & 0x0F;
+        minimum   = 0x800;
+    }
+    else if ((lead & 0xF8) == 0xF0)
+    {
+        unitCount = 4;
+        value     = lead & 0x07;
+        minimum   = 0x10000;
+    }
+    else { return -1; }
+
+    if (length < unitCount) { return -1; }
+
+    for (size_t i = 1; i < unitCount; i++)
+    {
+        if ((data[i] & 0xC0) != 0x80) { return -1; }
+
+        value = (value << 6) | (data[i] & 0x3F);
+    }
+
+    // Overlong encodings, surrogates and anything past the last codepoint are rejected.
+    const bool surrogate = value >= SURROGATE_FIRST && value <= SURROGATE_LAST;
+    if (value < minimum || value > MAX_CODEPOINT || surrogate) { return -1; }
+
+    *codepoint = value;
+    return unitCount;
+}
+
+bool sdl2::utf8::decode_string(std::string_view text, std::vector<uint32_t> &codepoints)
+{
+    const uint8_t *data = reinterpret_cast<const uint8_t *>(text.data());
+    const size_t length = text.length();
+
+    // There can't be more codepoints than bytes. This is trimmed to the real count at the end.
+    codepoints.resize(length);
+    uint32_t *output = codepoints.data();
+
+    size_t count{};
+    size_t i{};
+    while (i < length)
+    {
+        if (length - i >= BLOCK_SIZE && widen_ascii_block(&data[i], &output[count]))
+        {
+            i += BLOCK_SIZE;
+            count += BLOCK_SIZE;
+            continue;
+        }
+
+        const ssize_t unitCount = sdl2::utf8::decode(&output[count], &data[i], length - i);
+        if (unitCount <= 0) { break; }
+
+        i += unitCount;
+        ++count;
+    }
+
+    codepoints.resize(count);
+    return i == length;
+}
\ No newline at end of file
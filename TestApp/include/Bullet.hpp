@@ -4,10 +4,11 @@
 class Bullet final : public Object
 {
     public:
-        /// @brief Constructor. Loads the sprite.
+        /// @brief Constructor. Gets the sprite from the atlas.
+        /// @param atlas Atlas to get the sprite from.
         /// @param x X coordinate to construct at.
         /// @param y Y coordinate to construct at.
-        Bullet(int x, int y);
+        Bullet(const sdl2::TextureAtlas &atlas, int x, int y);
 
         /// @brief Runs the update routine. Moves the bullet.
         /// @param game Reference to game.
@@ -17,13 +17,14 @@ class Enemy final : public Object
             /// @brief Score points for the enemy.
             int score{};
 
-            /// @brief Path of the sprite.
+            /// @brief Path of the sprite. This is also its name in the atlas.
             std::string_view spritePath{};
         };
         // clang-format on
 
         /// @brief Generates a new enemy using random numbers.
-        Enemy();
+        /// @param atlas Atlas to get the sprite from.
+        Enemy(const sdl2::TextureAtlas &atlas);
 
         /// @brief Update routine.
         /// @param game Reference to game.
@@ -12,12 +12,18 @@ class Game final
         /// @brief Constructor.
         Game();
 
+        /// @brief Releases any resource handles while the renderer still exists.
+        ~Game();
+
         /// @brief Runs the application.
         int run() noexcept;
 
         /// @brief Adds the passed amount to the score count.
         void add_to_score(int add) noexcept;
 
+        /// @brief Returns the atlas every sprite is packed into.
+        const sdl2::TextureAtlas &get_sprite_atlas() const noexcept;
+
         /// @brief Returns a span of all of the in game objects.
         std::span<const UniqueObject> get_game_objects() const noexcept;
 
@@ -53,6 +59,18 @@ class Game final
         /// @brief System font.
         sdl2::SharedFont m_font{};
 
+        /// @brief Cache for the static wrapped text block. It's drawn once and replayed every frame after.
+        sdl2::RenderCache m_textCache;
+
+        /// @brief Textures the last run requested during startup.
+        sdl2::PreloadManifest m_preloadManifest{};
+
+        /// @brief Whether or not this run's manifest was written yet.
+        bool m_manifestWritten{};
+
+        /// @brief Atlas every sprite is packed into so drawing them doesn't switch textures.
+        sdl2::TextureAtlas m_spriteAtlas;
+
         /// @brief Vector of objects.
         std::vector<UniqueObject> m_objects;
 
@@ -62,6 +80,9 @@ class Game final
         /// @brief This is the "level". Really used as a spawn chance.
         int m_level{1};
 
+        /// @brief Whether or not the frame profiler overlay is shown.
+        bool m_showProfiler{};
+
         /// @brief Runs the update routine.
         void update();
 
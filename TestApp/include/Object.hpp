@@ -39,9 +39,9 @@ class Object
         virtual void render(sdl2::Renderer &renderer)
         {
             // This is just a generic sprite rendering routine.
-            if (!m_sprite->is_initialized()) { return; }
+            if (!m_sprite.is_initialized()) { return; }
 
-            m_sprite->render(m_x, m_y);
+            m_sprite.render(m_x, m_y);
         };
 
         /// @brief Returns whether or not the object can be purged or destroyed.
@@ -54,12 +54,12 @@ class Object
         Object::Type get_type() const noexcept { return m_type; }
 
         /// @brief Sets the sprite of the current Object.
-        /// @param sprite Sprite to assign to.
-        void set_sprite(sdl2::SharedTexture sprite)
+        /// @param sprite Sprite in the atlas to assign.
+        void set_sprite(const sdl2::SubTexture &sprite)
         {
             // Record width and height.
-            m_width  = sprite->get_width();
-            m_height = sprite->get_height();
+            m_width  = sprite.get_width();
+            m_height = sprite.get_height();
 
             // Assign.
             m_sprite = sprite;
@@ -93,8 +93,8 @@ class Object
         /// @brief Stores whether or not the object has served its purpose.
         bool m_isPurgable{};
 
-        /// @brief Sprite for rendering.
-        sdl2::SharedTexture m_sprite{};
+        /// @brief Sprite for rendering. Every sprite shares the same atlas page, so drawing them doesn't switch textures.
+        sdl2::SubTexture m_sprite{};
 
     private:
         /// @brief Stores the object type.
@@ -5,7 +5,8 @@ class Player final : public Object
 {
     public:
         /// @brief Constructor. Initializes player.
-        Player();
+        /// @param atlas Atlas to get the sprite from.
+        Player(const sdl2::TextureAtlas &atlas);
 
         /// @brief Runs the update routine.
         /// @param game Reference to main game class.
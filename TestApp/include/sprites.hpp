@@ -0,0 +1,17 @@
+#pragma once
+#include <array>
+#include <string_view>
+
+namespace sprites
+{
+    inline constexpr std::string_view PLAYER  = "romfs:/assets/PlayerA.png";
+    inline constexpr std::string_view BULLET  = "romfs:/assets/BulletA.png";
+    inline constexpr std::string_view ENEMY_A = "romfs:/assets/EnemyA.png";
+    inline constexpr std::string_view ENEMY_B = "romfs:/assets/EnemyB.png";
+    inline constexpr std::string_view ENEMY_C = "romfs:/assets/EnemyC.png";
+    inline constexpr std::string_view ENEMY_D = "romfs:/assets/EnemyD.png";
+    inline constexpr std::string_view ENEMY_E = "romfs:/assets/EnemyE.png";
+
+    /// @brief Every sprite packed into the game's atlas. Their paths double as their names in it.
+    inline constexpr std::array<std::string_view, 7> ALL = {PLAYER, BULLET, ENEMY_A, ENEMY_B, ENEMY_C, ENEMY_D, ENEMY_E};
+}
\ No newline at end of file
@@ -1,21 +1,19 @@
 #include "Bullet.hpp"
 
+#include "sprites.hpp"
 #include "window.hpp"
 
 //                      ---- Construction ----
 
-Bullet::Bullet(int x, int y)
+Bullet::Bullet(const sdl2::TextureAtlas &atlas, int x, int y)
     : Object(Object::Type::Bullet)
 {
-    // Path to load the sprite from.
-    static constexpr std::string_view BULLET_PATH = "romfs:/assets/BulletA.png";
-
     // Set x and y.
     m_x = x;
     m_y = y;
 
-    // Load sprite.
-    Object::set_sprite(sdl2::TextureManager::create_load_resource(BULLET_PATH, BULLET_PATH));
+    // Get the sprite.
+    Object::set_sprite(atlas.find(sprites::BULLET));
 }
 
 //                      ---- Public Functions ----
@@ -2,6 +2,7 @@
 
 #include "Game.hpp"
 #include "random.hpp"
+#include "sprites.hpp"
 #include "window.hpp"
 
 #include <array>
@@ -13,17 +14,17 @@ namespace
     constexpr size_t ENEMY_TOTAL = 5;
 
     /// @brief Array of enemy data. These are arranged according to sprite size.
-    std::array<Enemy::EnemyData, ENEMY_TOTAL> ENEMY_DATA_ARRAY = {{{1, 10, 100, "romfs:/assets/EnemyA.png"},
-                                                                   {2, 8, 200, "romfs:/assets/EnemyC.png"},
-                                                                   {3, 7, 300, "romfs:/assets/EnemyB.png"},
-                                                                   {4, 6, 400, "romfs:/assets/EnemyE.png"},
-                                                                   {8, 4, 800, "romfs:/assets/EnemyD.png"}}};
+    std::array<Enemy::EnemyData, ENEMY_TOTAL> ENEMY_DATA_ARRAY = {{{1, 10, 100, sprites::ENEMY_A},
+                                                                   {2, 8, 200, sprites::ENEMY_C},
+                                                                   {3, 7, 300, sprites::ENEMY_B},
+                                                                   {4, 6, 400, sprites::ENEMY_E},
+                                                                   {8, 4, 800, sprites::ENEMY_D}}};
 
 }
 
 //                      ---- Construction ----
 
-Enemy::Enemy()
+Enemy::Enemy(const sdl2::TextureAtlas &atlas)
     : Object(Object::Type::Enemy)
 {
     Enemy::initialize_static_members();
@@ -34,8 +35,8 @@ Enemy::Enemy()
     // Assign local pointer.
     m_enemyData = &ENEMY_DATA_ARRAY.at(enemyIndex);
 
-    // Load the sprite.
-    Object::set_sprite(sdl2::TextureManager::create_load_resource(m_enemyData->spritePath, m_enemyData->spritePath));
+    // Get the sprite.
+    Object::set_sprite(atlas.find(m_enemyData->spritePath));
 
     // Assign hitpoints.
     m_hitpoints = m_enemyData->hitpoints;
@@ -6,6 +6,7 @@
 #include "Logger.hpp"
 #include "Player.hpp"
 #include "random.hpp"
+#include "sprites.hpp"
 #include "window.hpp"
 
 #include <cstdlib>
@@ -17,8 +18,19 @@ namespace
     constexpr SDL_Color CLEAR_COLOR = {.r = 0x00, .g = 0x00, .b = 0x00, .a = 0xFF};
 
     constexpr std::string_view SYSTEM_FONT_NAME = "SystemFont";
+    constexpr std::string_view PROFILE_PATH     = "sdmc:/frame_profile.csv";
+    constexpr std::string_view MANIFEST_PATH    = "sdmc:/preload_manifest.txt";
+    constexpr std::string_view REPORT_PATH      = "sdmc:/resource_report.txt";
+    constexpr uint64_t RECORD_DURATION_MS       = 10000;
     constexpr std::string_view FONT_PATH        = "romfs:/assets/MainFont.ttf";
     constexpr int FONT_SIZE                     = 24;
+    constexpr size_t TEXTURE_CACHE_BUDGET       = 32 * 1024 * 1024;
+    constexpr uint32_t PRINTABLE_FIRST          = 0x20;
+    constexpr uint32_t PRINTABLE_LAST           = 0x7E;
+    constexpr int WRAP_WIDTH                    = 256;
+    constexpr int COUNTER_LINES                 = 3;
+    constexpr int SPRITE_ATLAS_WIDTH            = 256;
+    constexpr int SPRITE_ATLAS_HEIGHT           = 128;
 
     constexpr std::string_view TEST_WRAP =
         "A really, really, really, really, really, really, really, really, really, really, really, really, really, really, "
@@ -37,6 +49,8 @@ Game::Game()
     , m_window{window::WIDTH, window::HEIGHT}
     , m_renderer{m_window}
     , m_input{}
+    , m_textCache{WRAP_WIDTH, window::LOGICAL_HEIGHT}
+    , m_spriteAtlas{SPRITE_ATLAS_WIDTH, SPRITE_ATLAS_HEIGHT}
 {
     // Seed the random generator. This is one of those things I hate C++ for.
     std::srand(std::time(nullptr));
@@ -47,6 +61,16 @@ Game::Game()
     // Init textures.
     sdl2::Texture::initialize(m_renderer);
 
+    // Batch sprites and text into as few draw calls as possible.
+    m_renderer.set_batching(true);
+
+    // Keep recently used textures around so respawning doesn't reload them.
+    sdl2::TextureManager::set_cache_budget(TEXTURE_CACHE_BUDGET);
+
+    // Preload what the last run needed while starting up, then record what this one needs for the next.
+    m_preloadManifest.preload(MANIFEST_PATH);
+    sdl2::TextureManager::start_recording(RECORD_DURATION_MS);
+
     // Init font.
     sdl2::Font::add_break_points({L' ', L'.', L',', L'\n'});
     sdl2::Font::add_color_point(L'*', {0xFF, 0x00, 0x00, 0xFF});
@@ -54,13 +78,25 @@ Game::Game()
     // Load the system font.
     m_font = sdl2::FontManager::create_load_resource<sdl2::SystemFont>(SYSTEM_FONT_NAME, 10);
 
+    // Rasterize printable ASCII in the background so the first frames of text don't stall on it.
+    m_font->prewarm_range(PRINTABLE_FIRST, PRINTABLE_LAST);
+
+    // Pack every sprite into one page. The player, bullets, and enemies are all drawn from the same texture after.
+    for (const std::string_view spritePath : sprites::ALL) { m_spriteAtlas.add_image(spritePath, spritePath); }
+
     // Create the background.
     Game::create_add_object<Background>();
 
     // Create the player.
-    Game::create_add_object<Player>();
+    Game::create_add_object<Player>(m_spriteAtlas);
+
+    // Everything preloaded should be ready before the first frame.
+    m_preloadManifest.wait();
+    sdl2::GlyphRasterizer::finish_pending();
 }
 
+Game::~Game() { sdl2::TextureManager::release_all(); }
+
 //                      ---- Public Functions ----
 
 int Game::run() noexcept
@@ -70,8 +106,16 @@ int Game::run() noexcept
         // Update input.
         m_input.update();
 
-        // If plus is pressed, break.
-        if (m_input.button_pressed(HidNpadButton_Plus)) { return 0; }
+        // If plus is pressed, dump the frame timings and resource usage and break.
+        if (m_input.button_pressed(HidNpadButton_Plus))
+        {
+            m_renderer.get_frame_profiler().write_csv(PROFILE_PATH);
+            sdl2::resource_report::write(REPORT_PATH);
+            return 0;
+        }
+
+        // Minus toggles the profiler overlay.
+        if (m_input.button_pressed(HidNpadButton_Minus)) { m_showProfiler = !m_showProfiler; }
 
         // Update routine.
         Game::update();
@@ -83,6 +127,8 @@ int Game::run() noexcept
 
 void Game::add_to_score(int add) noexcept { m_score += add; }
 
+const sdl2::TextureAtlas &Game::get_sprite_atlas() const noexcept { return m_spriteAtlas; }
+
 std::span<const UniqueObject> Game::get_game_objects() const noexcept { return std::span<const UniqueObject>{m_objects}; }
 
 //                      ---- Private Functions ----
@@ -92,9 +138,17 @@ void Game::update()
     // Start by purging object.
     Game::purge_objects();
 
+    // Save what was requested once the recording is over. The preloaded textures have been picked up by then.
+    if (!m_manifestWritten && !sdl2::TextureManager::is_recording())
+    {
+        sdl2::PreloadManifest::write(MANIFEST_PATH);
+        m_preloadManifest.release();
+        m_manifestWritten = true;
+    }
+
     // Roll for enemy spawn.
     const bool spawnEnemy = generate_random(99) <= m_level;
-    if (spawnEnemy) { Game::create_add_object<Enemy>(); }
+    if (spawnEnemy) { Game::create_add_object<Enemy>(m_spriteAtlas); }
 
     // Loop and update.
     for (auto &object : m_objects) { object->update(this, m_input); }
@@ -106,18 +160,34 @@ void Game::render()
     static constexpr SDL_Color BLACK = {.r = 0x00, .g = 0x00, .b = 0x00, .a = 0x00};
     static constexpr SDL_Color WHITE = {.r = 0xFF, .g = 0xFF, .b = 0xFF, .a = 0xFF};
 
+    // X coordinate of the profiler overlay.
+    static constexpr int PROFILER_X = window::LOGICAL_WIDTH - 160;
+
     // Begin the frame.
     m_renderer.frame_begin(BLACK);
 
     // Loop and render.
     for (auto &object : m_objects) { object->render(m_renderer); }
 
-    m_font->render_text_wrapped(
-        0,
-        0,
-        WHITE,
-        256,
-        std::format("Objects: {}\nScore: {}\nLevel: {}\n{}", m_objects.size(), m_score, m_level, TEST_WRAP));
+    // The counters change almost every frame, so they're drawn directly.
+    std::string counters = std::format("Objects: {}\nScore: {}\nLevel: {}", m_objects.size(), m_score, m_level);
+    int counterLines     = COUNTER_LINES;
+
+    // Debug builds also show the texture switches. These stay flat however many enemies and bullets are on screen.
+    if (sdl2::RenderCounters::is_enabled())
+    {
+        const sdl2::FrameCounters lastFrame = sdl2::RenderCounters::get_last_frame();
+        counters += std::format("\nTextures: {} Switches: {}", lastFrame.distinctTextures, lastFrame.textureSwitches);
+        ++counterLines;
+    }
+    m_font->render_text(0, 0, WHITE, counters);
+
+    // The wrapped block never changes, so it's only drawn once and replayed from the cache after.
+    const int wrapY = counterLines * m_font->get_pixel_size() * 5 / 4;
+    m_textCache.render(m_renderer, 0, wrapY, [&]() { m_font->render_text_wrapped(0, 0, WHITE, WRAP_WIDTH, TEST_WRAP); });
+
+    // Frame timings in the top right.
+    if (m_showProfiler) { m_renderer.get_frame_profiler().render_overlay(m_renderer, *m_font, PROFILER_X, 0); }
 
     // Present.
     m_renderer.frame_end();
@@ -2,22 +2,18 @@
 
 #include "Bullet.hpp"
 #include "Game.hpp"
+#include "sprites.hpp"
 #include "window.hpp"
 
-namespace
-{
-    constexpr std::string_view PLAYER_SPRITE_PATH = "romfs:/assets/PlayerA.png";
-}
-
 //                      ---- Construction ----
 
-Player::Player()
+Player::Player(const sdl2::TextureAtlas &atlas)
     : Object(Object::Type::Player)
 {
     static constexpr int PLAYER_START_X = 16;
 
     // Set the sprite.
-    Object::set_sprite(sdl2::TextureManager::create_load_resource(PLAYER_SPRITE_PATH, PLAYER_SPRITE_PATH));
+    Object::set_sprite(atlas.find(sprites::PLAYER));
 
     // Set X and Y
     m_x = PLAYER_START_X;
@@ -63,5 +59,8 @@ void Player::update(Game *game, const sdl2::Input &input)
     if (moveLeft) { m_x += REVERSE_MOVEMENT; }
     else if (moveRight) { m_x += STATIC_MOVEMENT; };
 
-    if (firePressed) { game->create_add_object<Bullet>(m_x + BULLET_X_OFFSET, m_y + BULLET_Y_OFFSET); }
+    if (firePressed)
+    {
+        game->create_add_object<Bullet>(game->get_sprite_atlas(), m_x + BULLET_X_OFFSET, m_y + BULLET_Y_OFFSET);
+    }
 }
\ No newline at end of file